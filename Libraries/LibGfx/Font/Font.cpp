@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
 #include <AK/TypeCasts.h>
 #include <AK/Utf8View.h>
 #include <LibGfx/Font/Font.h>
@@ -20,10 +21,13 @@
 
 namespace Gfx {
 
+static Atomic<u64> s_next_font_unique_id { 1 };
+
 Font::Font(NonnullRefPtr<Typeface const> typeface, float point_width, float point_height, unsigned dpi_x, unsigned dpi_y)
     : m_typeface(move(typeface))
     , m_point_width(point_width)
     , m_point_height(point_height)
+    , m_unique_id(s_next_font_unique_id.fetch_add(1, AK::MemoryOrder::memory_order_relaxed))
 {
     float const units_per_em = m_typeface->units_per_em();
     m_x_scale = (point_width * dpi_x) / (POINTS_PER_INCH * units_per_em);
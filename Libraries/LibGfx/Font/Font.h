@@ -77,6 +77,9 @@ public:
 
     Typeface const& typeface() const { return m_typeface; }
 
+    // Identifies this font for as long as the process runs. Unlike the font's address, it's never reused by another font.
+    u64 unique_id() const { return m_unique_id; }
+
     SkFont skia_font(float scale) const;
 
     Font const& bold_variant() const;
@@ -94,6 +97,8 @@ private:
     FontPixelMetrics m_pixel_metrics;
 
     float m_pixel_size { 0.0f };
+
+    u64 m_unique_id { 0 };
 };
 
 }
@@ -7,6 +7,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BitCast.h>
+#include <AK/ByteBuffer.h>
+#include <AK/HashTable.h>
+#include <AK/IntrusiveList.h>
+#include <AK/NeverDestroyed.h>
+#include <AK/StringHash.h>
 #include <AK/Utf16View.h>
 #include <AK/Utf8View.h>
 #include <LibGfx/Point.h>
@@ -99,7 +105,7 @@ static hb_buffer_t* setup_text_shaping(UnicodeView const& string, Font const& fo
 }
 
 template<typename UnicodeView>
-NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, UnicodeView const& string, Font const& font, GlyphRun::TextType text_type, ShapeFeatures const& features)
+static NonnullRefPtr<GlyphRun> shape_text_at_origin(float letter_spacing, UnicodeView const& string, Font const& font, GlyphRun::TextType text_type, ShapeFeatures const& features)
 {
     auto* buffer = setup_text_shaping(string, font, features);
 
@@ -109,7 +115,7 @@ NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spaci
 
     Vector<DrawGlyph> glyph_run;
     glyph_run.ensure_capacity(glyph_count);
-    FloatPoint point = baseline_start;
+    FloatPoint point;
 
     // We track the code unit length rather than just the code unit offset because LibWeb may later collapse glyph runs.
     // Updating the offset of each glyph gets tricky when handling text direction (LTR/RTL). So rather than doing that,
@@ -147,7 +153,182 @@ NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spaci
         point.translate_by(letter_spacing, 0);
     }
 
-    return adopt_ref(*new GlyphRun(move(glyph_run), font, text_type, point.x() - baseline_start.x()));
+    return adopt_ref(*new GlyphRun(move(glyph_run), font, text_type, point.x()));
+}
+
+// Shaping the same text with the same font and settings always produces the same glyphs, and layout keeps shaping the
+// same words: on every relayout, and whenever lines are broken at a different width. So we remember the glyphs of the
+// most recently shaped text runs, and only run HarfBuzz for text we haven't seen in a while.
+// Glyphs are cached as if the text was shaped with its baseline starting at the origin, and moved to the requested
+// baseline start when they are handed out, so the same text shaped at different positions shares a cache entry.
+// NOTE: Like the HarfBuzz buffer above, this is only ever used from one thread.
+class ShapedTextCache {
+public:
+    static ShapedTextCache& the()
+    {
+        static NeverDestroyed<ShapedTextCache> cache;
+        return *cache;
+    }
+
+    struct Key {
+        Font const& font;
+        float letter_spacing { 0 };
+        GlyphRun::TextType text_type;
+        ShapeFeatures const& features;
+        // The UTF-8 (or ASCII) bytes of the text, or its UTF-16 code units if text_is_utf16 is set.
+        ReadonlyBytes text;
+        bool text_is_utf16 { false };
+    };
+
+    template<typename UnicodeView>
+    static Key key_for(float letter_spacing, UnicodeView const& string, Font const& font, GlyphRun::TextType text_type, ShapeFeatures const& features)
+    {
+        Key key { .font = font, .letter_spacing = letter_spacing, .text_type = text_type, .features = features, .text = {} };
+        if constexpr (IsSame<UnicodeView, Utf8View>) {
+            key.text = { string.bytes(), string.byte_length() };
+        } else if constexpr (IsSame<UnicodeView, Utf16View>) {
+            if (string.has_ascii_storage()) {
+                key.text = { string.ascii_span().data(), string.length_in_code_units() };
+            } else {
+                key.text = { string.utf16_span().data(), string.length_in_code_units() * sizeof(char16_t) };
+                key.text_is_utf16 = true;
+            }
+        } else {
+            static_assert(DependentFalse<UnicodeView>);
+        }
+        return key;
+    }
+
+    static bool can_cache(Key const& key) { return key.text.size() <= max_cached_text_length_in_bytes; }
+
+    RefPtr<GlyphRun> find(Key const& key, FloatPoint baseline_start)
+    {
+        auto it = m_entries.find(hash(key), [&](auto const& entry) { return entry->matches(key); });
+        if (it == m_entries.end())
+            return nullptr;
+
+        auto& entry = **it;
+        m_entries_by_last_use.remove(entry);
+        m_entries_by_last_use.append(entry);
+        return entry.create_glyph_run(key.font, baseline_start);
+    }
+
+    // Takes glyphs that were shaped with their baseline starting at the origin.
+    NonnullRefPtr<GlyphRun> add(Key const& key, NonnullRefPtr<GlyphRun> glyph_run_at_origin, FloatPoint baseline_start)
+    {
+        auto entry = make<Entry>(key, hash(key), *glyph_run_at_origin);
+        while (!m_entries_by_last_use.is_empty() && m_size_in_bytes + entry->size_in_bytes() > max_size_in_bytes) {
+            auto* least_recently_used_entry = m_entries_by_last_use.take_first();
+            m_size_in_bytes -= least_recently_used_entry->size_in_bytes();
+            auto it = m_entries.find(least_recently_used_entry->hash, [&](auto const& entry) { return entry.ptr() == least_recently_used_entry; });
+            m_entries.remove(it);
+        }
+
+        auto glyph_run = entry->create_glyph_run(key.font, baseline_start);
+        m_size_in_bytes += entry->size_in_bytes();
+        m_entries_by_last_use.append(*entry);
+        m_entries.set(move(entry));
+        return glyph_run;
+    }
+
+private:
+    static constexpr size_t max_size_in_bytes = 4 * MiB;
+    static constexpr size_t max_cached_text_length_in_bytes = 1024;
+
+    struct Entry {
+        Entry(Key const& key, unsigned hash, GlyphRun const& glyph_run)
+            : font_id(key.font.unique_id())
+            , letter_spacing(key.letter_spacing)
+            , text_type(key.text_type)
+            , features(key.features)
+            , text(MUST(ByteBuffer::copy(key.text)))
+            , text_is_utf16(key.text_is_utf16)
+            , hash(hash)
+            , glyphs(glyph_run.glyphs())
+            , width(glyph_run.width())
+        {
+        }
+
+        bool matches(Key const& key) const
+        {
+            if (font_id != key.font.unique_id() || letter_spacing != key.letter_spacing || text_type != key.text_type
+                || text_is_utf16 != key.text_is_utf16 || text.bytes() != key.text)
+                return false;
+            if (features.size() != key.features.size())
+                return false;
+            for (size_t i = 0; i < features.size(); ++i) {
+                if (__builtin_memcmp(features[i].tag, key.features[i].tag, sizeof(features[i].tag)) != 0 || features[i].value != key.features[i].value)
+                    return false;
+            }
+            return true;
+        }
+
+        size_t size_in_bytes() const
+        {
+            return sizeof(Entry) + features.size() * sizeof(ShapeFeature) + text.size() + glyphs.size() * sizeof(DrawGlyph);
+        }
+
+        // NOTE: Layout appends glyphs to the runs it's handed, so every caller gets glyphs of its own.
+        NonnullRefPtr<GlyphRun> create_glyph_run(Font const& font, FloatPoint baseline_start) const
+        {
+            Vector<DrawGlyph> glyphs_at_baseline_start { glyphs };
+            for (auto& glyph : glyphs_at_baseline_start)
+                glyph.position.translate_by(baseline_start);
+            return adopt_ref(*new GlyphRun(move(glyphs_at_baseline_start), font, text_type, width));
+        }
+
+        // NOTE: The font is identified by its unique ID rather than held on to, so that caching glyphs doesn't keep
+        //       fonts alive. Entries for fonts that are gone are never matched again, and age out like any other.
+        u64 font_id { 0 };
+        float letter_spacing { 0 };
+        GlyphRun::TextType text_type;
+        ShapeFeatures features;
+        ByteBuffer text;
+        bool text_is_utf16 { false };
+        unsigned hash { 0 };
+
+        Vector<DrawGlyph> glyphs;
+        float width { 0 };
+
+        IntrusiveListNode<Entry> list_node;
+    };
+
+    struct EntryTraits : public DefaultTraits<NonnullOwnPtr<Entry>> {
+        static unsigned hash(NonnullOwnPtr<Entry> const& entry) { return entry->hash; }
+        static bool equals(NonnullOwnPtr<Entry> const& a, NonnullOwnPtr<Entry> const& b) { return a.ptr() == b.ptr(); }
+    };
+
+    static unsigned hash(Key const& key)
+    {
+        auto hash = string_hash(reinterpret_cast<char const*>(key.text.data()), key.text.size());
+        hash = pair_int_hash(hash, u64_hash(key.font.unique_id()));
+        hash = pair_int_hash(hash, bit_cast<u32>(key.letter_spacing));
+        return pair_int_hash(hash, to_underlying(key.text_type));
+    }
+
+    HashTable<NonnullOwnPtr<Entry>, EntryTraits> m_entries;
+    IntrusiveList<&Entry::list_node> m_entries_by_last_use;
+    size_t m_size_in_bytes { 0 };
+};
+
+template<typename UnicodeView>
+NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, UnicodeView const& string, Font const& font, GlyphRun::TextType text_type, ShapeFeatures const& features)
+{
+    auto& cache = ShapedTextCache::the();
+    auto key = ShapedTextCache::key_for(letter_spacing, string, font, text_type, features);
+    if (!ShapedTextCache::can_cache(key)) {
+        // Shape at the origin and move the glyphs afterwards just like cached runs are, so that the glyph positions
+        // don't depend on whether the text was short enough to be cached.
+        auto glyph_run = shape_text_at_origin(letter_spacing, string, font, text_type, features);
+        for (auto& glyph : glyph_run->glyphs())
+            glyph.position.translate_by(baseline_start);
+        return glyph_run;
+    }
+
+    if (auto glyph_run = cache.find(key, baseline_start))
+        return glyph_run.release_nonnull();
+
+    return cache.add(key, shape_text_at_origin(letter_spacing, string, font, text_type, features), baseline_start);
 }
 
 template NonnullRefPtr<GlyphRun> shape_text(FloatPoint, float, Utf8View const&, Font const&, GlyphRun::TextType, ShapeFeatures const&);
@@ -247,7 +247,6 @@ InstantiationResult AbstractMachine::instantiate(Module const& module, Vector<Ex
             config.enable_instruction_count_limit();
         config.set_frame(Frame {
             auxiliary_instance,
-            Vector<Value> {},
             entry.expression(),
             1,
         });
@@ -268,7 +267,6 @@ InstantiationResult AbstractMachine::instantiate(Module const& module, Vector<Ex
                 config.enable_instruction_count_limit();
             config.set_frame(Frame {
                 auxiliary_instance,
-                Vector<Value> {},
                 entry,
                 entry.instructions().size(),
             });
@@ -303,7 +301,6 @@ InstantiationResult AbstractMachine::instantiate(Module const& module, Vector<Ex
             config.enable_instruction_count_limit();
         config.set_frame(Frame {
             auxiliary_instance,
-            Vector<Value> {},
             active_ptr->expression,
             1,
         });
@@ -338,7 +335,6 @@ InstantiationResult AbstractMachine::instantiate(Module const& module, Vector<Ex
                     config.enable_instruction_count_limit();
                 config.set_frame(Frame {
                     auxiliary_instance,
-                    Vector<Value> {},
                     data.offset,
                     1,
                 });
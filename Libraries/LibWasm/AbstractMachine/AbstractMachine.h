@@ -601,28 +601,28 @@ private:
 
 class Frame {
 public:
-    explicit Frame(ModuleInstance const& module, Vector<Value> locals, Expression const& expression, size_t arity)
+    explicit Frame(ModuleInstance const& module, Expression const& expression, size_t arity)
         : m_module(module)
-        , m_locals(move(locals))
         , m_expression(expression)
         , m_arity(arity)
     {
     }
 
     auto& module() const { return m_module; }
-    auto& locals() const { return m_locals; }
-    auto& locals() { return m_locals; }
     auto& expression() const { return m_expression; }
     auto arity() const { return m_arity; }
     auto label_index() const { return m_label_index; }
     auto& label_index() { return m_label_index; }
+    // The locals themselves live in the owning Configuration's locals stack, starting at this offset.
+    auto locals_offset() const { return m_locals_offset; }
+    auto& locals_offset() { return m_locals_offset; }
 
 private:
     ModuleInstance const& m_module;
-    Vector<Value> m_locals;
     Expression const& m_expression;
     size_t m_arity { 0 };
     size_t m_label_index { 0 };
+    size_t m_locals_offset { 0 };
 };
 
 using InstantiationResult = AK::ErrorOr<NonnullOwnPtr<ModuleInstance>, InstantiationError>;
@@ -727,3 +727,11 @@ struct AK::Traits<Wasm::Linker::Name> : public AK::DefaultTraits<Wasm::Linker::N
     static unsigned hash(Wasm::Linker::Name const& entry) { return pair_int_hash(entry.module.hash(), entry.name.hash()); }
     static bool equals(Wasm::Linker::Name const& a, Wasm::Linker::Name const& b) { return a.name == b.name && a.module == b.module; }
 };
+
+template<>
+struct AK::Formatter<Wasm::InstantiationError> : public AK::Formatter<StringView> {
+    ErrorOr<void> format(FormatBuilder& builder, Wasm::InstantiationError const& error)
+    {
+        return Formatter<StringView>::format(builder, error.error);
+    }
+};
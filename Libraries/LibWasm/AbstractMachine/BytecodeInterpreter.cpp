@@ -18,6 +18,7 @@
 #include <LibWasm/AbstractMachine/BytecodeInterpreter.h>
 #include <LibWasm/AbstractMachine/Configuration.h>
 #include <LibWasm/AbstractMachine/Operators.h>
+#include <LibWasm/AbstractMachine/Profiler.h>
 #include <LibWasm/Opcode.h>
 #include <LibWasm/Printer/Printer.h>
 #include <LibWasm/Types.h>
@@ -63,25 +64,37 @@ struct ConvertToRaw<double> {
 void BytecodeInterpreter::interpret(Configuration& configuration)
 {
     m_trap = Empty {};
-    auto& expression = configuration.frame().expression();
-    auto const should_limit_instruction_count = configuration.should_limit_instruction_count();
-    if (!expression.compiled_instructions.dispatches.is_empty()) {
-        if (should_limit_instruction_count)
-            return interpret_impl<true, true>(configuration, expression);
-        return interpret_impl<true, false>(configuration, expression);
-    }
-    if (should_limit_instruction_count)
-        return interpret_impl<false, true>(configuration, expression);
-    return interpret_impl<false, false>(configuration, expression);
+    // Profiling shares the instrumented variant of the loop with the instruction limit,
+    // so that the interpreter loop doesn't get instantiated yet again.
+    auto const needs_instrumentation = configuration.should_limit_instruction_count() || m_profiler;
+    // NOTE: The instruction count is carried over into the callee of a tail call, as the restarted loop still belongs
+    //       to the same call; otherwise a tail-recursive loop would never hit the limit.
+    u64 executed_instructions = 0;
+    // A tail call replaces the current frame and leaves the loop, so that it can be restarted on the callee's body.
+    do {
+        m_pending_tail_call = false;
+        auto& expression = configuration.frame().expression();
+        if (!expression.compiled_instructions.dispatches.is_empty()) {
+            if (needs_instrumentation)
+                interpret_impl<true, true>(configuration, expression, executed_instructions);
+            else
+                interpret_impl<true, false>(configuration, expression, executed_instructions);
+        } else {
+            if (needs_instrumentation)
+                interpret_impl<false, true>(configuration, expression, executed_instructions);
+            else
+                interpret_impl<false, false>(configuration, expression, executed_instructions);
+        }
+    } while (m_pending_tail_call);
 }
 
 template<bool HasCompiledList, bool HasDynamicInsnLimit>
-void BytecodeInterpreter::interpret_impl(Configuration& configuration, Expression const& expression)
+void BytecodeInterpreter::interpret_impl(Configuration& configuration, Expression const& expression, u64& executed_instructions)
 {
     auto& instructions = expression.instructions();
     u64 max_ip_value = HasCompiledList ? expression.compiled_instructions.dispatches.size() : instructions.size();
     auto& current_ip_value = configuration.ip();
-    u64 executed_instructions = 0;
+    auto const should_limit_instruction_count = HasDynamicInsnLimit && configuration.should_limit_instruction_count();
     configuration.sources[0] = Dispatch::RegisterOrStack::Stack;
     configuration.sources[1] = Dispatch::RegisterOrStack::Stack;
     configuration.sources[2] = Dispatch::RegisterOrStack::Stack;
@@ -97,7 +110,7 @@ void BytecodeInterpreter::interpret_impl(Configuration& configuration, Expressio
 
     while (current_ip_value < max_ip_value) {
         if constexpr (HasDynamicInsnLimit) {
-            if (executed_instructions++ >= Constants::max_allowed_executed_instructions_per_call) [[unlikely]] {
+            if (should_limit_instruction_count && executed_instructions++ >= Constants::max_allowed_executed_instructions_per_call) [[unlikely]] {
                 m_trap = Trap::from_string("Exceeded maximum allowed number of instructions");
                 return;
             }
@@ -115,6 +128,11 @@ void BytecodeInterpreter::interpret_impl(Configuration& configuration, Expressio
 
             auto const opcode = instruction->opcode().value();
 
+            if constexpr (HasDynamicInsnLimit) {
+                if (m_profiler) [[unlikely]]
+                    m_profiler->did_execute_instruction(instruction->opcode());
+            }
+
 #define RUN_NEXT_INSTRUCTION(ip_changed)                      \
     {                                                         \
         if constexpr (ip_changed == CouldHaveChangedIP::No) { \
@@ -285,7 +303,15 @@ void BytecodeInterpreter::interpret_impl(Configuration& configuration, Expressio
                     return;
                 RUN_NEXT_INSTRUCTION(CouldHaveChangedIP::Yes);
             }
-            case Instructions::call_indirect.value(): {
+            case Instructions::return_call.value(): {
+                auto index = instruction->arguments().get<FunctionIndex>();
+                auto address = configuration.frame().module().functions()[index.value()];
+                dbgln_if(WASM_TRACE_DEBUG, "return_call({})", address.value());
+                tail_call_address(configuration, address);
+                return;
+            }
+            case Instructions::call_indirect.value():
+            case Instructions::return_call_indirect.value(): {
                 auto& args = instruction->arguments().get<Instruction::IndirectCallArgs>();
                 auto table_address = configuration.frame().module().tables()[args.table.value()];
                 auto table_instance = configuration.store().get(table_address);
@@ -303,6 +329,12 @@ void BytecodeInterpreter::interpret_impl(Configuration& configuration, Expressio
                 TRAP_IN_LOOP_IF_NOT(type_actual.parameters() == type_expected.parameters());
                 TRAP_IN_LOOP_IF_NOT(type_actual.results() == type_expected.results());
 
+                if (opcode == Instructions::return_call_indirect.value()) {
+                    dbgln_if(WASM_TRACE_DEBUG, "return_call_indirect({} -> {})", index, address.value());
+                    tail_call_address(configuration, address, CallAddressSource::IndirectCall);
+                    return;
+                }
+
                 dbgln_if(WASM_TRACE_DEBUG, "call_indirect({} -> {})", index, address.value());
                 if (call_address(configuration, address, CallAddressSource::IndirectCall))
                     return;
@@ -404,7 +436,7 @@ void BytecodeInterpreter::interpret_impl(Configuration& configuration, Expressio
                 auto value = configuration.source_value(0); // bounds checked by verifier.
                 auto local_index = instruction->local_index();
                 dbgln_if(WASM_TRACE_DEBUG, "stack:peek -> locals({})", local_index.value());
-                configuration.frame().locals()[local_index.value()] = value;
+                configuration.local(local_index) = value;
                 RUN_NEXT_INSTRUCTION(CouldHaveChangedIP::No);
             }
             case Instructions::global_get.value(): {
@@ -1322,14 +1354,8 @@ void BytecodeInterpreter::interpret_impl(Configuration& configuration, Expressio
                 auto& arg = instruction->arguments().get<Instruction::ShuffleArgument>();
                 auto b = pop_vector<u8, MakeUnsigned>(configuration, 0);
                 auto a = pop_vector<u8, MakeUnsigned>(configuration, 1);
-                using VectorType = Native128ByteVectorOf<u8, MakeUnsigned>;
-                VectorType result;
-                for (size_t i = 0; i < 16; ++i)
-                    if (arg.lanes[i] < 16)
-                        result[i] = a[arg.lanes[i]];
-                    else
-                        result[i] = b[arg.lanes[i] - 16];
-                configuration.push_to_destination(Value(bit_cast<u128>(result)));
+                auto result = Operators::VectorShuffle {}(bit_cast<u128>(a), bit_cast<u128>(b), bit_cast<u128>(arg.lanes));
+                configuration.push_to_destination(Value(result));
                 RUN_NEXT_INSTRUCTION(CouldHaveChangedIP::No);
             }
             case Instructions::v128_store.value():
@@ -2398,6 +2424,43 @@ bool BytecodeInterpreter::call_address(Configuration& configuration, FunctionAdd
     if (source == CallAddressSource::IndirectCall) {
         TRAP_IF_NOT(type->parameters().size() <= configuration.value_stack().size());
     }
+
+    if (m_profiler)
+        m_profiler->enter_function(address);
+
+    if (auto* wasm_function = instance->get_pointer<WasmFunction>()) {
+        // The callee's locals and results never leave the configuration's stacks, so this path doesn't allocate.
+        auto stack_height = configuration.value_stack().size() - type->parameters().size();
+        {
+            CallFrameHandle handle { *this, configuration };
+            configuration.set_frame_with_arguments_from_stack(
+                Frame { wasm_function->module(), wasm_function->code().func().body(), type->results().size() },
+                type->parameters().size(),
+                wasm_function->code().func().locals());
+            configuration.ip() = 0;
+            interpret(configuration);
+            if (!did_trap())
+                configuration.label_stack().take_last();
+        }
+
+        if (m_profiler)
+            m_profiler->exit_function();
+
+        if (did_trap())
+            return true;
+
+        // Move the results down to where the arguments were, dropping anything the callee left below them.
+        auto& value_stack = configuration.value_stack();
+        auto result_count = type->results().size();
+        auto results_start = value_stack.size() - result_count;
+        if (results_start != stack_height) {
+            for (size_t i = 0; i < result_count; ++i)
+                value_stack[stack_height + i] = value_stack[results_start + i];
+            value_stack.shrink(stack_height + result_count, true);
+        }
+        return false;
+    }
+
     Vector<Value> args;
     args.ensure_capacity(type->parameters().size());
     auto span = configuration.value_stack().span().slice_from_end(type->parameters().size());
@@ -2406,13 +2469,10 @@ bool BytecodeInterpreter::call_address(Configuration& configuration, FunctionAdd
 
     configuration.value_stack().remove(configuration.value_stack().size() - span.size(), span.size());
 
-    Result result { Trap::from_string("") };
-    if (instance->has<WasmFunction>()) {
-        CallFrameHandle handle { *this, configuration };
-        result = configuration.call(*this, address, move(args));
-    } else {
-        result = configuration.call(*this, address, move(args));
-    }
+    auto result = configuration.call(*this, address, move(args));
+
+    if (m_profiler)
+        m_profiler->exit_function();
 
     if (result.is_trap()) {
         m_trap = move(result.trap());
@@ -2426,6 +2486,36 @@ bool BytecodeInterpreter::call_address(Configuration& configuration, FunctionAdd
     return false;
 }
 
+void BytecodeInterpreter::tail_call_address(Configuration& configuration, FunctionAddress address, CallAddressSource source)
+{
+    auto instance = configuration.store().get(address);
+    auto* wasm_function = instance->get_pointer<WasmFunction>();
+    if (!wasm_function) {
+        // Host functions don't get a frame of their own, so there is nothing to reuse; call it, and return what it returned.
+        if (call_address(configuration, address, source))
+            return;
+        while (configuration.label_stack().size() - 1 != configuration.frame().label_index())
+            configuration.label_stack().take_last();
+        return;
+    }
+
+    auto& type = wasm_function->type();
+    if (source == CallAddressSource::IndirectCall) {
+        if (trap_if_not(type.parameters().size() <= configuration.value_stack().size(), "Not enough arguments for tail call"sv))
+            return;
+    }
+
+    if (m_profiler)
+        m_profiler->replace_function(address);
+
+    configuration.replace_frame_with_arguments_from_stack(
+        Frame { wasm_function->module(), wasm_function->code().func().body(), type.results().size() },
+        type.parameters().size(),
+        wasm_function->code().func().locals());
+    configuration.ip() = 0;
+    m_pending_tail_call = true;
+}
+
 template<typename PopTypeLHS, typename PushType, typename Operator, typename PopTypeRHS, typename... Args>
 bool BytecodeInterpreter::binary_numeric_operation(Configuration& configuration, Args&&... args)
 {
@@ -27,6 +27,10 @@ struct BytecodeInterpreter final : public Interpreter {
         return m_trap.get<Trap>();
     }
     virtual void clear_trap() final { m_trap = Empty {}; }
+
+    // While a profiler is set, every executed instruction and call is reported to it.
+    void set_profiler(Profiler* profiler) { m_profiler = profiler; }
+
     virtual void visit_external_resources(HostVisitOps const& host) override
     {
         if (auto ptr = m_trap.get_pointer<Trap>())
@@ -53,7 +57,7 @@ struct BytecodeInterpreter final : public Interpreter {
     };
 
     template<bool HasCompiledList, bool HasDynamicInsnLimit>
-    void interpret_impl(Configuration&, Expression const&);
+    void interpret_impl(Configuration&, Expression const&, u64& executed_instructions);
 
 protected:
     void branch_to_label(Configuration&, LabelIndex);
@@ -81,6 +85,7 @@ protected:
     VectorType pop_vector(Configuration&, size_t source);
     bool store_to_memory(Configuration&, Instruction::MemoryArgument const&, ReadonlyBytes data, u32 base);
     bool call_address(Configuration&, FunctionAddress, CallAddressSource = CallAddressSource::DirectCall);
+    void tail_call_address(Configuration&, FunctionAddress, CallAddressSource = CallAddressSource::DirectCall);
 
     template<typename PopTypeLHS, typename PushType, typename Operator, typename PopTypeRHS = PopTypeLHS, typename... Args>
     bool binary_numeric_operation(Configuration&, Args&&...);
@@ -112,6 +117,8 @@ protected:
 
     Variant<Trap, Empty> m_trap;
     StackInfo const& m_stack_info;
+    Profiler* m_profiler { nullptr };
+    bool m_pending_tail_call { false };
 };
 
 }
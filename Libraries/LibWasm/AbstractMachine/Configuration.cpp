@@ -13,10 +13,11 @@ namespace Wasm {
 
 void Configuration::unwind(Badge<CallFrameHandle>, CallFrameHandle const& frame_handle)
 {
-    m_frame_stack.take_last();
+    auto frame = m_frame_stack.take_last();
+    m_locals_stack.shrink(frame.locals_offset(), true);
     m_depth--;
     m_ip = frame_handle.ip.value();
-    m_locals_base = m_frame_stack.is_empty() ? nullptr : m_frame_stack.unchecked_last().locals().data();
+    m_locals_base = m_frame_stack.is_empty() ? nullptr : m_locals_stack.data() + m_frame_stack.unchecked_last().locals_offset();
 }
 
 Result Configuration::call(Interpreter& interpreter, FunctionAddress address, Vector<Value> arguments)
@@ -25,19 +26,14 @@ Result Configuration::call(Interpreter& interpreter, FunctionAddress address, Ve
     if (!function)
         return Trap::from_string("Attempt to call nonexistent function by address");
     if (auto* wasm_function = function->get_pointer<WasmFunction>()) {
-        Vector<Value> locals = move(arguments);
-        locals.ensure_capacity(locals.size() + wasm_function->code().func().locals().size());
-        for (auto& local : wasm_function->code().func().locals()) {
-            for (size_t i = 0; i < local.n(); ++i)
-                locals.append(Value(local.type()));
-        }
-
-        set_frame(Frame {
-            wasm_function->module(),
-            move(locals),
-            wasm_function->code().func().body(),
-            wasm_function->type().results().size(),
-        });
+        set_frame(
+            Frame {
+                wasm_function->module(),
+                wasm_function->code().func().body(),
+                wasm_function->type().results().size(),
+            },
+            arguments,
+            wasm_function->code().func().locals());
         m_ip = 0;
         return execute(interpreter);
     }
@@ -19,16 +19,45 @@ public:
     {
     }
 
-    void set_frame(Frame frame)
+    // The locals of all active frames live back to back in a single stack, so once that has grown to fit
+    // the deepest call seen so far, entering a frame no longer allocates.
+    void set_frame(Frame frame, ReadonlySpan<Value> arguments = {}, ReadonlySpan<Locals> declared_locals = {})
     {
-        Label label(frame.arity(), frame.expression().instructions().size(), m_value_stack.size());
-        frame.label_index() = m_label_stack.size();
-        if (auto hint = frame.expression().stack_usage_hint(); hint.has_value())
-            m_value_stack.ensure_capacity(*hint + m_value_stack.size());
-        m_frame_stack.append(move(frame));
-        m_label_stack.append(label);
-        m_locals_base = m_frame_stack.unchecked_last().locals().data();
+        frame.locals_offset() = m_locals_stack.size();
+        m_locals_stack.append(arguments.data(), arguments.size());
+        append_declared_locals(declared_locals);
+        push_frame(move(frame));
     }
+
+    // Like set_frame(), but the arguments are moved off the top of the value stack.
+    void set_frame_with_arguments_from_stack(Frame frame, size_t argument_count, ReadonlySpan<Locals> declared_locals)
+    {
+        frame.locals_offset() = m_locals_stack.size();
+        m_locals_stack.append(m_value_stack.span().slice_from_end(argument_count).data(), argument_count);
+        m_value_stack.shrink(m_value_stack.size() - argument_count, true);
+        append_declared_locals(declared_locals);
+        push_frame(move(frame));
+    }
+
+    // Replaces the current frame in place, as a tail call does: the arguments on top of the value stack become
+    // the new frame's locals, and everything else the current frame had on the value and label stacks is dropped.
+    void replace_frame_with_arguments_from_stack(Frame frame, size_t argument_count, ReadonlySpan<Locals> declared_locals)
+    {
+        auto locals_offset = m_frame_stack.unchecked_last().locals_offset();
+        while (m_label_stack.size() - 1 != m_frame_stack.unchecked_last().label_index())
+            m_label_stack.take_last();
+        auto stack_height = m_label_stack.take_last().stack_height();
+        m_frame_stack.take_last();
+
+        m_locals_stack.shrink(locals_offset, true);
+        m_locals_stack.append(m_value_stack.span().slice_from_end(argument_count).data(), argument_count);
+        m_value_stack.shrink(stack_height, true);
+        append_declared_locals(declared_locals);
+
+        frame.locals_offset() = locals_offset;
+        push_frame(move(frame));
+    }
+
     ALWAYS_INLINE auto& frame() const { return m_frame_stack.unchecked_last(); }
     ALWAYS_INLINE auto& frame() { return m_frame_stack.unchecked_last(); }
     ALWAYS_INLINE auto& ip() const { return m_ip; }
@@ -118,8 +147,28 @@ public:
     };
 
 private:
+    void append_declared_locals(ReadonlySpan<Locals> declared_locals)
+    {
+        for (auto& local : declared_locals) {
+            for (size_t i = 0; i < local.n(); ++i)
+                m_locals_stack.append(Value(local.type()));
+        }
+    }
+
+    void push_frame(Frame frame)
+    {
+        Label label(frame.arity(), frame.expression().instructions().size(), m_value_stack.size());
+        frame.label_index() = m_label_stack.size();
+        if (auto hint = frame.expression().stack_usage_hint(); hint.has_value())
+            m_value_stack.ensure_capacity(*hint + m_value_stack.size());
+        m_locals_base = m_locals_stack.data() + frame.locals_offset();
+        m_frame_stack.append(move(frame));
+        m_label_stack.append(label);
+    }
+
     Store& m_store;
     Vector<Value, 64, FastLastAccess::Yes> m_value_stack;
+    Vector<Value, 64> m_locals_stack;
     DoublyLinkedList<Label, 128> m_label_stack;
     DoublyLinkedList<Frame, 128> m_frame_stack;
     size_t m_depth { 0 };
@@ -22,10 +22,58 @@ namespace Wasm::Operators {
 
 using namespace AK::SIMD;
 
+// Operators that have a lane-wise equivalent on native vector types expose it as a static `vectorized()`.
+// The vector operators below pick that form at compile time when it exists, so that the compiler can emit
+// the corresponding SSE/AVX/NEON instructions instead of a per-lane loop.
+template<typename Op, typename... Vectors>
+concept HasNativeVectorForm = requires(Vectors... vectors) { Op::vectorized(vectors...); };
+
+namespace Detail {
+
+template<typename T, size_t N>
+using NativeVectorOf __attribute__((vector_size(N * sizeof(T)))) = T;
+
+template<SIMDVector V>
+using UnsignedVectorFor = NativeVectorOf<MakeUnsigned<ElementOf<V>>, vector_length<V>>;
+
+template<SIMDVector V, SIMDVector Mask>
+ALWAYS_INLINE static V select(Mask mask, V if_true, V if_false)
+{
+    static_assert(sizeof(Mask) == sizeof(V));
+    if constexpr (IsIntegral<ElementOf<V>>) {
+        auto bits = bit_cast<V>(mask);
+        return (if_true & bits) | (if_false & ~bits);
+    } else {
+        static_assert(sizeof(V) == sizeof(u64x2));
+        auto bits = bit_cast<u64x2>(mask);
+        return bit_cast<V>((bit_cast<u64x2>(if_true) & bits) | (bit_cast<u64x2>(if_false) & ~bits));
+    }
+}
+
+template<size_t Offset, size_t Stride, SIMDVector V, size_t... Idx>
+ALWAYS_INLINE static auto extract_lanes(V vector, IndexSequence<Idx...>)
+{
+    return __builtin_shufflevector(vector, vector, (Offset + Idx * Stride)...);
+}
+
+template<SIMDVector V, size_t... Idx>
+ALWAYS_INLINE static auto concat_lanes(V low, V high, IndexSequence<Idx...>)
+{
+    return __builtin_shufflevector(low, high, Idx...);
+}
+
+}
+
 #define DEFINE_BINARY_OPERATOR(Name, operation) \
     struct Name {                               \
         template<typename Lhs, typename Rhs>    \
         auto operator()(Lhs lhs, Rhs rhs) const \
+        {                                       \
+            return lhs operation rhs;           \
+        }                                       \
+                                                \
+        template<SIMDVector V>                  \
+        static auto vectorized(V lhs, V rhs)    \
         {                                       \
             return lhs operation rhs;           \
         }                                       \
@@ -36,19 +84,47 @@ using namespace AK::SIMD;
         }                                       \
     }
 
+// Signed lane overflow is undefined on native vectors just like it is on scalars,
+// so integer arithmetic is carried out on the unsigned lane type to get wrapping semantics.
+#define DEFINE_WRAPPING_BINARY_OPERATOR(Name, operation)                                       \
+    struct Name {                                                                              \
+        template<typename Lhs, typename Rhs>                                                   \
+        auto operator()(Lhs lhs, Rhs rhs) const                                                \
+        {                                                                                      \
+            return lhs operation rhs;                                                          \
+        }                                                                                      \
+                                                                                               \
+        template<SIMDVector V>                                                                 \
+        static V vectorized(V lhs, V rhs)                                                      \
+        {                                                                                      \
+            if constexpr (IsFloatingPoint<ElementOf<V>>) {                                     \
+                return lhs operation rhs;                                                      \
+            } else {                                                                           \
+                using Unsigned = Detail::UnsignedVectorFor<V>;                                 \
+                return bit_cast<V>(bit_cast<Unsigned>(lhs) operation bit_cast<Unsigned>(rhs)); \
+            }                                                                                  \
+        }                                                                                      \
+                                                                                               \
+        static StringView name()                                                               \
+        {                                                                                      \
+            return #operation##sv;                                                             \
+        }                                                                                      \
+    }
+
 DEFINE_BINARY_OPERATOR(Equals, ==);
 DEFINE_BINARY_OPERATOR(NotEquals, !=);
 DEFINE_BINARY_OPERATOR(GreaterThan, >);
 DEFINE_BINARY_OPERATOR(LessThan, <);
 DEFINE_BINARY_OPERATOR(LessThanOrEquals, <=);
 DEFINE_BINARY_OPERATOR(GreaterThanOrEquals, >=);
-DEFINE_BINARY_OPERATOR(Add, +);
-DEFINE_BINARY_OPERATOR(Subtract, -);
-DEFINE_BINARY_OPERATOR(Multiply, *);
+DEFINE_WRAPPING_BINARY_OPERATOR(Add, +);
+DEFINE_WRAPPING_BINARY_OPERATOR(Subtract, -);
+DEFINE_WRAPPING_BINARY_OPERATOR(Multiply, *);
 DEFINE_BINARY_OPERATOR(BitAnd, &);
 DEFINE_BINARY_OPERATOR(BitOr, |);
 DEFINE_BINARY_OPERATOR(BitXor, ^);
 
+#undef DEFINE_WRAPPING_BINARY_OPERATOR
 #undef DEFINE_BINARY_OPERATOR
 
 struct Divide {
@@ -66,6 +142,13 @@ struct Divide {
         }
     }
 
+    template<SIMDVector V>
+    requires(IsFloatingPoint<ElementOf<V>>)
+    static V vectorized(V lhs, V rhs)
+    {
+        return lhs / rhs;
+    }
+
     static StringView name() { return "/"sv; }
 };
 
@@ -92,6 +175,14 @@ struct Average {
         return static_cast<Lhs>((lhs + rhs + 1) / 2);
     }
 
+    // (a + b + 1) / 2 without the intermediate overflow, this is what pavgb/urhadd compute.
+    template<SIMDVector V>
+    requires(IsUnsigned<ElementOf<V>>)
+    static V vectorized(V lhs, V rhs)
+    {
+        return (lhs | rhs) - ((lhs ^ rhs) >> 1);
+    }
+
     static StringView name() { return "avgr"sv; }
 };
 
@@ -123,6 +214,9 @@ struct BitAndNot {
     template<typename Lhs, typename Rhs>
     auto operator()(Lhs lhs, Rhs rhs) const { return lhs & ~rhs; }
 
+    template<SIMDVector V>
+    static V vectorized(V lhs, V rhs) { return lhs & ~rhs; }
+
     static StringView name() { return "andnot"sv; }
 };
 
@@ -248,6 +342,28 @@ struct VectorSwizzle {
     static StringView name() { return "vec(8x16).swizzle"sv; }
 };
 
+struct VectorShuffle {
+    auto operator()(u128 c1, u128 c2, u128 lanes) const
+    {
+        // https://webassembly.github.io/spec/core/bikeshed/#-mathsfi8x16hrefsyntax-instr-vecmathsfshufflex%E2%91%A0
+        using VectorType = Native128ByteVectorOf<u8, MakeUnsigned>;
+        auto a = bit_cast<VectorType>(c1);
+        auto b = bit_cast<VectorType>(c2);
+        auto control = bit_cast<i8x16>(lanes);
+        // Lanes are validated to be < 32, so selecting from the concatenation of a and b is a single two-source shuffle.
+        // Otherwise, pick each half with a zeroing shuffle (pshufb/tbl) and merge them.
+#if __has_builtin(__builtin_shuffle)
+        VectorType result = __builtin_shuffle(a, b, bit_cast<VectorType>(control));
+#else
+        auto from_a = shuffle_or_0(bit_cast<i8x16>(a), control);
+        auto from_b = shuffle_or_0(bit_cast<i8x16>(b), control - 16);
+        auto result = bit_cast<VectorType>(from_a | from_b);
+#endif
+        return bit_cast<u128>(result);
+    }
+    static StringView name() { return "vec(8x16).shuffle"sv; }
+};
+
 template<size_t VectorSize, template<typename> typename SetSign>
 struct VectorExtractLane {
     size_t lane;
@@ -336,6 +452,10 @@ struct VectorCmpOp {
     auto operator()(u128 c1, u128 c2) const
     {
         using ElementType = NativeIntegralType<128 / VectorSize>;
+        using VectorType = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
+        if constexpr (HasNativeVectorForm<Op, VectorType, VectorType>)
+            return bit_cast<u128>(Op::vectorized(bit_cast<VectorType>(c1), bit_cast<VectorType>(c2)));
+
         auto result = bit_cast<Native128ByteVectorOf<ElementType, SetSign>>(c1);
         auto other = bit_cast<Native128ByteVectorOf<ElementType, SetSign>>(c2);
         Op op;
@@ -370,6 +490,9 @@ struct VectorFloatCmpOp {
     {
         auto first = bit_cast<NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>>(c1);
         auto other = bit_cast<NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>>(c2);
+        if constexpr (HasNativeVectorForm<Op, decltype(first), decltype(other)>)
+            return bit_cast<u128>(Op::vectorized(first, other));
+
         using ElementType = NativeIntegralType<128 / VectorSize>;
         Native128ByteVectorOf<ElementType, MakeUnsigned> result;
         Op op;
@@ -404,6 +527,17 @@ struct Minimum {
         return min(lhs, rhs);
     }
 
+    template<SIMDVector V>
+    requires(IsIntegral<ElementOf<V>>)
+    static V vectorized(V lhs, V rhs)
+    {
+#if __has_builtin(__builtin_elementwise_min)
+        return __builtin_elementwise_min(lhs, rhs);
+#else
+        return Detail::select(lhs < rhs, lhs, rhs);
+#endif
+    }
+
     static StringView name() { return "minimum"sv; }
 };
 
@@ -420,6 +554,17 @@ struct Maximum {
         return max(lhs, rhs);
     }
 
+    template<SIMDVector V>
+    requires(IsIntegral<ElementOf<V>>)
+    static V vectorized(V lhs, V rhs)
+    {
+#if __has_builtin(__builtin_elementwise_max)
+        return __builtin_elementwise_max(lhs, rhs);
+#else
+        return Detail::select(lhs < rhs, rhs, lhs);
+#endif
+    }
+
     static StringView name() { return "maximum"sv; }
 };
 
@@ -430,6 +575,12 @@ struct PseudoMinimum {
         return rhs < lhs ? rhs : lhs;
     }
 
+    template<SIMDVector V>
+    static V vectorized(V lhs, V rhs)
+    {
+        return Detail::select(rhs < lhs, rhs, lhs);
+    }
+
     static StringView name() { return "pseudo_minimum"sv; }
 };
 
@@ -440,6 +591,12 @@ struct PseudoMaximum {
         return lhs < rhs ? rhs : lhs;
     }
 
+    template<SIMDVector V>
+    static V vectorized(V lhs, V rhs)
+    {
+        return Detail::select(lhs < rhs, rhs, lhs);
+    }
+
     static StringView name() { return "pseudo_maximum"sv; }
 };
 
@@ -509,6 +666,15 @@ struct PopCount {
             VERIFY_NOT_REACHED();
     }
 
+#if __has_builtin(__builtin_elementwise_popcount)
+    template<SIMDVector V>
+    requires(IsIntegral<ElementOf<V>>)
+    static V vectorized(V lhs)
+    {
+        return __builtin_elementwise_popcount(lhs);
+    }
+#endif
+
     static StringView name() { return "popcnt"sv; }
 };
 
@@ -527,6 +693,20 @@ struct Absolute {
         return AK::abs(lhs);
     }
 
+    template<SIMDVector V>
+    static V vectorized(V lhs)
+    {
+        if constexpr (IsFloatingPoint<ElementOf<V>>) {
+            // Only the sign bit is cleared, NaN payloads are preserved as the spec requires.
+            using Unsigned = Detail::NativeVectorOf<NativeIntegralType<sizeof(ElementOf<V>) * 8>, vector_length<V>>;
+            return bit_cast<V>(bit_cast<Unsigned>(lhs) & (NumericLimits<ElementOf<Unsigned>>::max() >> 1));
+        } else {
+            using Unsigned = Detail::UnsignedVectorFor<V>;
+            auto negated = bit_cast<V>(Unsigned {} - bit_cast<Unsigned>(lhs));
+            return Detail::select(lhs < V {}, negated, lhs);
+        }
+    }
+
     static StringView name() { return "abs"sv; }
 };
 
@@ -545,6 +725,17 @@ struct Negate {
         return -lhs;
     }
 
+    template<SIMDVector V>
+    static V vectorized(V lhs)
+    {
+        if constexpr (IsFloatingPoint<ElementOf<V>>) {
+            return -lhs;
+        } else {
+            using Unsigned = Detail::UnsignedVectorFor<V>;
+            return bit_cast<V>(Unsigned {} - bit_cast<Unsigned>(lhs));
+        }
+    }
+
     static StringView name() { return "== 0"sv; }
 };
 
@@ -563,6 +754,15 @@ struct Ceil {
             VERIFY_NOT_REACHED();
     }
 
+#if __has_builtin(__builtin_elementwise_ceil)
+    template<SIMDVector V>
+    requires(IsFloatingPoint<ElementOf<V>>)
+    static V vectorized(V lhs)
+    {
+        return __builtin_elementwise_ceil(lhs);
+    }
+#endif
+
     static StringView name() { return "ceil"sv; }
 };
 
@@ -573,10 +773,15 @@ struct VectorIntegerExtOpPairwise {
         using VectorResult = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
         using VectorInput = NativeVectorType<128 / (VectorSize * 2), VectorSize * 2, SetSign>;
         auto vector = bit_cast<VectorInput>(c);
+        if constexpr (HasNativeVectorForm<Op, VectorResult, VectorResult>) {
+            auto even = __builtin_convertvector(Detail::extract_lanes<0, 2>(vector, MakeIndexSequence<VectorSize>()), VectorResult);
+            auto odd = __builtin_convertvector(Detail::extract_lanes<1, 2>(vector, MakeIndexSequence<VectorSize>()), VectorResult);
+            return bit_cast<u128>(Op::vectorized(even, odd));
+        }
+
         VectorResult result;
         Op op;
 
-        // FIXME: Find a way to not loop here
         for (size_t i = 0; i < VectorSize; ++i) {
             result[i] = op(vector[i * 2], vector[(i * 2) + 1]);
         }
@@ -611,19 +816,9 @@ struct VectorIntegerExt {
         using VectorResult = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
         using VectorInput = NativeVectorType<128 / (VectorSize * 2), VectorSize * 2, SetSign>;
         auto vector = bit_cast<VectorInput>(c);
-        VectorResult result;
-
-        // FIXME: Find a way to not loop here
-        for (size_t i = 0; i < VectorSize; ++i) {
-            if constexpr (Mode == VectorExt::High)
-                result[i] = vector[VectorSize + i];
-            else if constexpr (Mode == VectorExt::Low)
-                result[i] = vector[i];
-            else
-                VERIFY_NOT_REACHED();
-        }
-
-        return bit_cast<u128>(result);
+        constexpr size_t offset = Mode == VectorExt::High ? VectorSize : 0;
+        auto half = Detail::extract_lanes<offset, 1>(vector, MakeIndexSequence<VectorSize>());
+        return bit_cast<u128>(__builtin_convertvector(half, VectorResult));
     }
 
     static StringView name()
@@ -649,11 +844,17 @@ struct VectorIntegerExtOp {
         using VectorInput = NativeVectorType<128 / (VectorSize * 2), VectorSize * 2, SetSign>;
         auto first = bit_cast<VectorInput>(lhs);
         auto second = bit_cast<VectorInput>(rhs);
+        if constexpr (HasNativeVectorForm<Op, VectorResult, VectorResult>) {
+            constexpr size_t offset = Mode == VectorExt::High ? VectorSize : 0;
+            auto a = __builtin_convertvector(Detail::extract_lanes<offset, 1>(first, MakeIndexSequence<VectorSize>()), VectorResult);
+            auto b = __builtin_convertvector(Detail::extract_lanes<offset, 1>(second, MakeIndexSequence<VectorSize>()), VectorResult);
+            return bit_cast<u128>(Op::vectorized(a, b));
+        }
+
         VectorResult result;
         Op op;
 
         using ResultType = SetSign<NativeIntegralType<128 / VectorSize>>;
-        // FIXME: Find a way to not loop here
         for (size_t i = 0; i < VectorSize; ++i) {
             if constexpr (Mode == VectorExt::High) {
                 ResultType a = first[VectorSize + i];
@@ -692,10 +893,12 @@ struct VectorIntegerBinaryOp {
         using VectorType = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
         auto first = bit_cast<VectorType>(lhs);
         auto second = bit_cast<VectorType>(rhs);
+        if constexpr (HasNativeVectorForm<Op, VectorType, VectorType>)
+            return bit_cast<u128>(Op::vectorized(first, second));
+
         VectorType result;
         Op op;
 
-        // FIXME: Find a way to not loop here
         for (size_t i = 0; i < VectorSize; ++i) {
             result[i] = op(first[i], second[i]);
         }
@@ -745,16 +948,12 @@ struct VectorDotProduct {
         using VectorResult = NativeVectorType<128 / VectorSize, VectorSize, MakeSigned>;
         auto v1 = bit_cast<VectorInput>(lhs);
         auto v2 = bit_cast<VectorInput>(rhs);
-        VectorResult result;
 
-        using ResultType = MakeUnsigned<NativeIntegralType<128 / VectorSize>>;
-        for (size_t i = 0; i < VectorSize; ++i) {
-            ResultType low = v1[i * 2] * v2[i * 2];
-            ResultType high = v1[(i * 2) + 1] * v2[(i * 2) + 1];
-            result[i] = low + high;
-        }
-
-        return bit_cast<u128>(result);
+        // This is the pmaddwd pattern: widen the even and odd lanes, multiply them, and add the products (wrapping).
+        auto widen = [](auto lanes) { return __builtin_convertvector(lanes, VectorResult); };
+        auto low = Multiply::vectorized(widen(Detail::extract_lanes<0, 2>(v1, MakeIndexSequence<VectorSize>())), widen(Detail::extract_lanes<0, 2>(v2, MakeIndexSequence<VectorSize>())));
+        auto high = Multiply::vectorized(widen(Detail::extract_lanes<1, 2>(v1, MakeIndexSequence<VectorSize>())), widen(Detail::extract_lanes<1, 2>(v2, MakeIndexSequence<VectorSize>())));
+        return bit_cast<u128>(Add::vectorized(low, high));
     }
 
     static StringView name() { return "dot"sv; }
@@ -766,27 +965,19 @@ struct VectorNarrow {
     {
         using VectorInput = NativeVectorType<128 / (VectorSize / 2), VectorSize / 2, MakeSigned>;
         using VectorResult = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
+        using VectorHalf = Detail::NativeVectorOf<ElementOf<VectorResult>, VectorSize / 2>;
         auto v1 = bit_cast<VectorInput>(lhs);
         auto v2 = bit_cast<VectorInput>(rhs);
-        VectorResult result;
 
-        for (size_t i = 0; i < (VectorSize / 2); ++i) {
-            if (v1[i] <= NumericLimits<Element>::min())
-                result[i] = NumericLimits<Element>::min();
-            else if (v1[i] >= NumericLimits<Element>::max())
-                result[i] = NumericLimits<Element>::max();
-            else
-                result[i] = v1[i];
-        }
-        for (size_t i = 0; i < (VectorSize / 2); ++i) {
-            if (v2[i] <= NumericLimits<Element>::min())
-                result[i + VectorSize / 2] = NumericLimits<Element>::min();
-            else if (v2[i] >= NumericLimits<Element>::max())
-                result[i + VectorSize / 2] = NumericLimits<Element>::max();
-            else
-                result[i + VectorSize / 2] = v2[i];
-        }
+        auto clamp_and_narrow = [](VectorInput vector) {
+            VectorInput const lower = VectorInput {} + static_cast<ElementOf<VectorInput>>(NumericLimits<Element>::min());
+            VectorInput const upper = VectorInput {} + static_cast<ElementOf<VectorInput>>(NumericLimits<Element>::max());
+            vector = Detail::select(vector < lower, lower, vector);
+            vector = Detail::select(upper < vector, upper, vector);
+            return __builtin_convertvector(vector, VectorHalf);
+        };
 
+        VectorResult result = Detail::concat_lanes(clamp_and_narrow(v1), clamp_and_narrow(v2), MakeIndexSequence<VectorSize>());
         return bit_cast<u128>(result);
     }
 
@@ -799,10 +990,12 @@ struct VectorIntegerUnaryOp {
     {
         using VectorType = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
         auto value = bit_cast<VectorType>(lhs);
+        if constexpr (HasNativeVectorForm<Op, VectorType>)
+            return bit_cast<u128>(Op::vectorized(value));
+
         VectorType result;
         Op op;
 
-        // FIXME: Find a way to not loop here
         for (size_t i = 0; i < VectorSize; ++i) {
             result[i] = op(value[i]);
         }
@@ -834,6 +1027,9 @@ struct VectorFloatBinaryOp {
         using VectorType = NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>;
         auto first = bit_cast<VectorType>(lhs);
         auto second = bit_cast<VectorType>(rhs);
+        if constexpr (HasNativeVectorForm<Op, VectorType, VectorType>)
+            return bit_cast<u128>(Op::vectorized(first, second));
+
         VectorType result;
         Op op;
         for (size_t i = 0; i < VectorSize; ++i) {
@@ -861,6 +1057,9 @@ struct VectorFloatUnaryOp {
     {
         using VectorType = NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>;
         auto value = bit_cast<VectorType>(lhs);
+        if constexpr (HasNativeVectorForm<Op, VectorType>)
+            return bit_cast<u128>(Op::vectorized(value));
+
         VectorType result;
         Op op;
         for (size_t i = 0; i < VectorSize; ++i) {
@@ -882,12 +1081,20 @@ struct VectorFloatUnaryOp {
     }
 };
 
+template<typename ResultT>
+struct Convert;
+
 template<size_t ResultSize, size_t InputSize, typename ResultType, typename InputType, typename Op>
 struct VectorConvertOp {
     auto operator()(u128 lhs) const
     {
         using VectorInput = NativeVectorType<128 / InputSize, InputSize, MakeUnsigned>;
         using VectorResult = NativeVectorType<128 / ResultSize, ResultSize, MakeUnsigned>;
+
+        // Plain numeric conversions map directly onto cvtdq2ps/cvtps2pd/scvtf and friends.
+        if constexpr (IsSpecializationOf<Op, Convert>)
+            return convert_natively(lhs);
+
         auto value = bit_cast<VectorInput>(lhs);
         VectorResult result;
         Op op;
@@ -906,6 +1113,27 @@ struct VectorConvertOp {
         return bit_cast<u128>(result);
     }
 
+    static u128 convert_natively(u128 lhs)
+    {
+        using ConvertedType = decltype(declval<Op>()(declval<InputType>()));
+        using VectorInput = Detail::NativeVectorOf<InputType, InputSize>;
+        using VectorResult = Detail::NativeVectorOf<ConvertedType, ResultSize>;
+        auto value = bit_cast<VectorInput>(lhs);
+
+        if constexpr (InputSize == ResultSize) {
+            return bit_cast<u128>(__builtin_convertvector(value, VectorResult));
+        } else if constexpr (InputSize > ResultSize) {
+            auto low = Detail::extract_lanes<0, 1>(value, MakeIndexSequence<ResultSize>());
+            return bit_cast<u128>(__builtin_convertvector(low, VectorResult));
+        } else {
+            // The upper lanes of the result are zeroed.
+            using VectorConverted = Detail::NativeVectorOf<ConvertedType, InputSize>;
+            auto converted = __builtin_convertvector(value, VectorConverted);
+            VectorResult result = Detail::concat_lanes(converted, VectorConverted {}, MakeIndexSequence<ResultSize>());
+            return bit_cast<u128>(result);
+        }
+    }
+
     static StringView name()
     {
         switch (ResultSize) {
@@ -934,6 +1162,15 @@ struct Floor {
             VERIFY_NOT_REACHED();
     }
 
+#if __has_builtin(__builtin_elementwise_floor)
+    template<SIMDVector V>
+    requires(IsFloatingPoint<ElementOf<V>>)
+    static V vectorized(V lhs)
+    {
+        return __builtin_elementwise_floor(lhs);
+    }
+#endif
+
     static StringView name() { return "floor"sv; }
 };
 
@@ -952,6 +1189,15 @@ struct Truncate {
             VERIFY_NOT_REACHED();
     }
 
+#if __has_builtin(__builtin_elementwise_trunc)
+    template<SIMDVector V>
+    requires(IsFloatingPoint<ElementOf<V>>)
+    static V vectorized(V lhs)
+    {
+        return __builtin_elementwise_trunc(lhs);
+    }
+#endif
+
     static StringView name() { return "truncate"sv; }
 };
 
@@ -967,6 +1213,16 @@ struct NearbyIntegral {
             VERIFY_NOT_REACHED();
     }
 
+    // Wasm's "nearest" always rounds ties to even, regardless of the current rounding mode.
+#if __has_builtin(__builtin_elementwise_roundeven)
+    template<SIMDVector V>
+    requires(IsFloatingPoint<ElementOf<V>>)
+    static V vectorized(V lhs)
+    {
+        return __builtin_elementwise_roundeven(lhs);
+    }
+#endif
+
     static StringView name() { return "round"sv; }
 };
 
@@ -982,6 +1238,15 @@ struct SquareRoot {
             VERIFY_NOT_REACHED();
     }
 
+#if __has_builtin(__builtin_elementwise_sqrt)
+    template<SIMDVector V>
+    requires(IsFloatingPoint<ElementOf<V>>)
+    static V vectorized(V lhs)
+    {
+        return __builtin_elementwise_sqrt(lhs);
+    }
+#endif
+
     static StringView name() { return "sqrt"sv; }
 };
 
@@ -1157,6 +1422,27 @@ struct SaturatingOp {
         return static_cast<ResultT>(result);
     }
 
+    // Only the 8- and 16-bit lane shapes have saturating vector instructions, so that's all we provide here.
+    template<SIMDVector V>
+    requires(sizeof(ResultT) <= 2 && IsSame<ElementOf<V>, ResultT>)
+    static V vectorized(V lhs, V rhs)
+    {
+#if __has_builtin(__builtin_elementwise_add_sat) && __has_builtin(__builtin_elementwise_sub_sat)
+        if constexpr (IsSame<Op, Add>)
+            return __builtin_elementwise_add_sat(lhs, rhs);
+        if constexpr (IsSame<Op, Subtract>)
+            return __builtin_elementwise_sub_sat(lhs, rhs);
+#endif
+        using Wide = Detail::NativeVectorOf<i32, vector_length<V>>;
+        Op op;
+        Wide result = op(__builtin_convertvector(lhs, Wide), __builtin_convertvector(rhs, Wide));
+        Wide const lower = Wide {} + static_cast<i32>(NumericLimits<ResultT>::min());
+        Wide const upper = Wide {} + static_cast<i32>(NumericLimits<ResultT>::max());
+        result = Detail::select(result < lower, lower, result);
+        result = Detail::select(upper < result, upper, result);
+        return __builtin_convertvector(result, V);
+    }
+
     static StringView name() { return "saturating_op"sv; }
 };
 
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/LEB128.h>
+#include <AK/MemoryStream.h>
+#include <AK/QuickSort.h>
+#include <AK/StringBuilder.h>
+#include <LibWasm/AbstractMachine/Profiler.h>
+#include <LibWasm/Printer/Printer.h>
+
+namespace Wasm {
+
+// https://webassembly.github.io/spec/core/appendix/custom.html#name-section
+static ErrorOr<void> parse_function_names(ReadonlyBytes contents, HashMap<u32, ByteString>& names)
+{
+    static constexpr u8 function_names_subsection_id = 1;
+
+    FixedMemoryStream stream { contents };
+    while (!stream.is_eof()) {
+        auto id = TRY(stream.read_value<u8>());
+        u32 size = TRY(stream.read_value<LEB128<u32>>());
+        if (id != function_names_subsection_id) {
+            TRY(stream.discard(size));
+            continue;
+        }
+
+        u32 count = TRY(stream.read_value<LEB128<u32>>());
+        for (u32 i = 0; i < count; ++i) {
+            u32 index = TRY(stream.read_value<LEB128<u32>>());
+            u32 length = TRY(stream.read_value<LEB128<u32>>());
+            auto name = TRY(ByteBuffer::create_uninitialized(length));
+            TRY(stream.read_until_filled(name));
+            names.set(index, ByteString(name.bytes()));
+        }
+    }
+    return {};
+}
+
+void Profiler::register_module(Module const& module, ModuleInstance const& instance)
+{
+    HashMap<u32, ByteString> names;
+    for (auto const& section : module.custom_sections()) {
+        if (section.name() != "name"sv)
+            continue;
+        // A malformed name section must not prevent the module from being used, so just keep whatever we managed to read.
+        if (auto result = parse_function_names(section.contents(), names); result.is_error())
+            dbgln("Ignoring malformed name section: {}", result.error());
+    }
+
+    for (auto const& entry : instance.exports()) {
+        if (auto address = entry.value().get_pointer<FunctionAddress>())
+            m_function_names.ensure(*address, [&] { return entry.name(); });
+    }
+
+    for (size_t index = 0; index < instance.functions().size(); ++index) {
+        auto address = instance.functions()[index];
+        if (auto name = names.get(index); name.has_value())
+            m_function_names.set(address, *name);
+        else
+            m_function_names.ensure(address, [&] { return ByteString::formatted("func[{}]", index); });
+    }
+}
+
+void Profiler::enter_function(FunctionAddress address)
+{
+    auto& children = m_nodes[m_current_node].children;
+    if (auto child = children.get(address); child.has_value()) {
+        m_current_node = *child;
+    } else {
+        auto index = m_nodes.size();
+        children.set(address, index);
+        m_nodes.append({ .function = address, .parent = m_current_node });
+        m_current_node = index;
+    }
+    ++m_nodes[m_current_node].calls;
+}
+
+void Profiler::exit_function()
+{
+    VERIFY(m_current_node != 0);
+    m_current_node = m_nodes[m_current_node].parent;
+}
+
+void Profiler::replace_function(FunctionAddress address)
+{
+    // The outermost function is entered without being reported, so its samples are attributed to the root;
+    // keep it that way for whatever it tail-calls.
+    if (m_current_node == 0)
+        return;
+    exit_function();
+    enter_function(address);
+}
+
+ByteString Profiler::function_name(FunctionAddress address) const
+{
+    if (auto name = m_function_names.get(address); name.has_value())
+        return *name;
+    return ByteString::formatted("function@{}", address.value());
+}
+
+ErrorOr<void> Profiler::write_collapsed_stacks(Stream& stream) const
+{
+    // Nodes are always appended after their parent, so a single forward pass can build every node's stack.
+    Vector<ByteString> stacks;
+    stacks.ensure_capacity(m_nodes.size());
+    stacks.append("<root>"sv);
+
+    for (size_t index = 1; index < m_nodes.size(); ++index) {
+        auto const& node = m_nodes[index];
+        auto name = function_name(*node.function);
+        if (node.parent == 0)
+            stacks.append(move(name));
+        else
+            stacks.append(ByteString::formatted("{};{}", stacks[node.parent], name));
+    }
+
+    for (size_t index = 0; index < m_nodes.size(); ++index) {
+        if (m_nodes[index].self_samples == 0)
+            continue;
+        TRY(stream.write_formatted("{} {}\n", stacks[index], m_nodes[index].self_samples));
+    }
+    return {};
+}
+
+ErrorOr<void> Profiler::write_opcode_histogram(Stream& stream) const
+{
+#define M(name, ...) static_assert(opcode_for_slot(opcode_slot(Instructions::name)) == Instructions::name, "Every opcode needs a counter of its own");
+    ENUMERATE_WASM_OPCODES(M)
+#undef M
+
+    HashMap<u64, u64> opcode_counts;
+    for (size_t slot = 0; slot < m_opcode_counts.size(); ++slot) {
+        if (m_opcode_counts[slot] != 0)
+            opcode_counts.set(opcode_for_slot(slot).value(), m_opcode_counts[slot]);
+    }
+
+    Vector<HashMap<u64, u64>::Entry const*> entries;
+    entries.ensure_capacity(opcode_counts.size());
+    for (auto const& entry : opcode_counts)
+        entries.unchecked_append(&entry);
+
+    quick_sort(entries, [](auto const* a, auto const* b) { return a->value > b->value; });
+
+    for (auto const* entry : entries)
+        TRY(stream.write_formatted("{} {}\n", instruction_name(OpCode { entry->key }), entry->value));
+    return {};
+}
+
+ErrorOr<void> Profiler::write_function_calls(Stream& stream) const
+{
+    struct FunctionCalls {
+        ByteString name;
+        u64 calls { 0 };
+        u64 self_instructions { 0 };
+    };
+
+    // A function shows up once for every distinct stack it was called from, so sum up all of its call tree nodes.
+    HashMap<FunctionAddress, FunctionCalls> calls_by_function;
+    for (size_t index = 1; index < m_nodes.size(); ++index) {
+        auto const& node = m_nodes[index];
+        auto& function_calls = calls_by_function.ensure(*node.function, [&] { return FunctionCalls { .name = function_name(*node.function) }; });
+        function_calls.calls += node.calls;
+        function_calls.self_instructions += node.self_instructions;
+    }
+
+    Vector<FunctionCalls> entries;
+    entries.ensure_capacity(calls_by_function.size());
+    for (auto& entry : calls_by_function)
+        entries.unchecked_append(move(entry.value));
+
+    quick_sort(entries, [](auto const& a, auto const& b) {
+        if (a.calls != b.calls)
+            return a.calls > b.calls;
+        return a.name < b.name;
+    });
+
+    for (auto const& entry : entries)
+        TRY(stream.write_formatted("{} {} {}\n", entry.name, entry.calls, entry.self_instructions));
+    return {};
+}
+
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/Stream.h>
+#include <AK/Vector.h>
+#include <LibWasm/AbstractMachine/AbstractMachine.h>
+
+namespace Wasm {
+
+// Collects per-opcode execution counts and call-stack samples while a BytecodeInterpreter runs.
+// Stacks are sampled every `sample_interval` executed instructions, so a sample count is proportional
+// to the time spent in that stack rather than to the number of calls made to it.
+class Profiler {
+public:
+    explicit Profiler(u64 sample_interval = 1000)
+        : m_sample_interval(sample_interval)
+    {
+        m_nodes.append({ .function = {}, .parent = 0 });
+    }
+
+    // Resolves the names of all the functions in `instance`, first from the `name` custom section of `module`,
+    // then from its exports, and falls back to `func[index]`.
+    void register_module(Module const&, ModuleInstance const&);
+    void set_function_name(FunctionAddress address, ByteString name) { m_function_names.set(address, move(name)); }
+
+    void enter_function(FunctionAddress);
+    void exit_function();
+    // Called for tail calls, where the callee takes over the current function's place in the stack.
+    void replace_function(FunctionAddress);
+
+    ALWAYS_INLINE void did_execute_instruction(OpCode opcode)
+    {
+        ++m_opcode_counts[opcode_slot(opcode)];
+        auto& node = m_nodes[m_current_node];
+        ++node.self_instructions;
+        if (++m_instructions_since_last_sample >= m_sample_interval) {
+            m_instructions_since_last_sample = 0;
+            ++node.self_samples;
+        }
+    }
+
+    // One line per distinct stack, "outer;inner;innermost <samples>", as consumed by flamegraph.pl and friends.
+    ErrorOr<void> write_collapsed_stacks(Stream&) const;
+    // One line per opcode, "<opcode name> <count>", most executed first.
+    ErrorOr<void> write_opcode_histogram(Stream&) const;
+    // One line per called function, "<function name> <calls> <self instructions>", most called first.
+    ErrorOr<void> write_function_calls(Stream&) const;
+
+private:
+    struct CallTreeNode {
+        Optional<FunctionAddress> function;
+        size_t parent { 0 };
+        HashMap<FunctionAddress, size_t> children {};
+        u64 calls { 0 };
+        u64 self_samples { 0 };
+        u64 self_instructions { 0 };
+    };
+
+    ByteString function_name(FunctionAddress) const;
+
+    // Opcodes keep their prefix (0x00 for single-byte opcodes, then 0xfc, 0xfd and 0xfe) in the top byte and the
+    // opcode itself in the low byte, which packs every one of them into four blocks of 256 counters.
+    static constexpr size_t opcode_slot_count = 4 * 256;
+    static constexpr size_t opcode_slot(OpCode opcode)
+    {
+        auto prefix = opcode.value() >> 56;
+        auto block = prefix == 0 ? 0 : prefix - 0xfb;
+        return block * 256 + (opcode.value() & 0xff);
+    }
+    static constexpr OpCode opcode_for_slot(size_t slot)
+    {
+        u64 block = slot / 256;
+        u64 prefix = block == 0 ? 0 : block + 0xfb;
+        return OpCode { (prefix << 56) | (slot % 256) };
+    }
+
+    Vector<CallTreeNode> m_nodes;
+    size_t m_current_node { 0 };
+    Array<u64, opcode_slot_count> m_opcode_counts {};
+    HashMap<FunctionAddress, ByteString> m_function_names;
+    u64 m_sample_interval { 1000 };
+    u64 m_instructions_since_last_sample { 0 };
+};
+
+}
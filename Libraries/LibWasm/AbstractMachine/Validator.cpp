@@ -2138,6 +2138,51 @@ VALIDATE_INSTRUCTION(call_indirect)
     return {};
 }
 
+// https://webassembly.github.io/tail-call/core/valid/instructions.html#xref-syntax-instructions-syntax-instr-control-mathsf-return-call-x
+VALIDATE_INSTRUCTION(return_call)
+{
+    auto index = instruction.arguments().get<FunctionIndex>();
+    TRY(validate(index));
+
+    auto& function_type = m_context.functions[index.value()];
+    if (function_type.results() != m_frames.first().type.results())
+        return Errors::invalid("result types of tail-called function"sv);
+
+    for (size_t i = 0; i < function_type.parameters().size(); ++i)
+        TRY(stack.take(function_type.parameters()[function_type.parameters().size() - i - 1]));
+
+    m_frames.last().unreachable = true;
+    stack.resize(m_frames.last().initial_size);
+
+    return {};
+}
+
+// https://webassembly.github.io/tail-call/core/valid/instructions.html#xref-syntax-instructions-syntax-instr-control-mathsf-return-call-indirect-x-y
+VALIDATE_INSTRUCTION(return_call_indirect)
+{
+    auto& args = instruction.arguments().get<Instruction::IndirectCallArgs>();
+    TRY(validate(args.table));
+    TRY(validate(args.type));
+
+    auto& table = m_context.tables[args.table.value()];
+    if (table.element_type().kind() != ValueType::FunctionReference)
+        return Errors::invalid("table element type for return.call.indirect"sv, "a function reference"sv, table.element_type());
+
+    auto& type = m_context.types[args.type.value()];
+    if (type.results() != m_frames.first().type.results())
+        return Errors::invalid("result types of tail-called function"sv);
+
+    TRY(stack.take<ValueType::I32>());
+
+    for (size_t i = 0; i < type.parameters().size(); ++i)
+        TRY(stack.take(type.parameters()[type.parameters().size() - i - 1]));
+
+    m_frames.last().unreachable = true;
+    stack.resize(m_frames.last().initial_size);
+
+    return {};
+}
+
 VALIDATE_INSTRUCTION(v128_load)
 {
     auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
@@ -9,6 +9,7 @@
 namespace Wasm {
 
 class AbstractMachine;
+class Profiler;
 class Validator;
 struct ValidationError;
 struct Interpreter;
@@ -258,12 +258,14 @@ ParseResult<Instruction> Instruction::parse(ConstrainedStream& stream)
         auto default_label = TRY(GenericIndexParser<LabelIndex>::parse(stream));
         return Instruction { opcode, TableBranchArgs { labels, default_label } };
     }
-    case Instructions::call.value(): {
+    case Instructions::call.value():
+    case Instructions::return_call.value(): {
         // call function
         auto function_index = TRY(GenericIndexParser<FunctionIndex>::parse(stream));
         return Instruction { opcode, function_index };
     }
-    case Instructions::call_indirect.value(): {
+    case Instructions::call_indirect.value():
+    case Instructions::return_call_indirect.value(): {
         // call_indirect type table
         auto type_index = TRY(GenericIndexParser<TypeIndex>::parse(stream));
         auto table_index = TRY(GenericIndexParser<TableIndex>::parse(stream));
@@ -720,6 +720,8 @@ HashMap<Wasm::OpCode, ByteString> Wasm::Names::instruction_names {
     { Instructions::return_, "return" },
     { Instructions::call, "call" },
     { Instructions::call_indirect, "call.indirect" },
+    { Instructions::return_call, "return.call" },
+    { Instructions::return_call_indirect, "return.call.indirect" },
     { Instructions::drop, "drop" },
     { Instructions::select, "select" },
     { Instructions::select_typed, "select.typed" },
@@ -0,0 +1,65 @@
+// (module
+//   (func (export "count") (param $n i32) (param $acc i32) (result i32)
+//     (if (result i32) (i32.eqz (local.get $n))
+//       (then (local.get $acc))
+//       (else (return_call 0 (i32.sub (local.get $n) (i32.const 1)) (i32.add (local.get $acc) (i32.const 1)))))))
+test("deep tail recursion runs in a constant number of frames", () => {
+    // prettier-ignore
+    const binary = new Uint8Array([
+        0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x07, 0x01, 0x60, 0x02, 0x7f, 0x7f, 0x01,
+        0x7f, 0x03, 0x02, 0x01, 0x00, 0x07, 0x09, 0x01, 0x05, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x00, 0x00,
+        0x0a, 0x19, 0x01, 0x17, 0x00, 0x20, 0x00, 0x45, 0x04, 0x7f, 0x20, 0x01, 0x05, 0x20, 0x00, 0x41,
+        0x01, 0x6b, 0x20, 0x01, 0x41, 0x01, 0x6a, 0x12, 0x00, 0x0b, 0x0b,
+    ]);
+    const module = parseWebAssemblyModule(binary);
+    const count = module.getExport("count");
+    // Far more iterations than there could be nested frames, so this only passes if the frame is reused.
+    expect(module.invoke(count, 1000000, 0)).toBe(1000000);
+});
+
+// (module
+//   (type $returns_i32 (func (result i32)))
+//   (type $takes_and_returns_i32 (func (param i32) (result i32)))
+//   (table 1 funcref)
+//   (elem (i32.const 0) $seven)
+//   (func $seven (type $returns_i32) (i32.const 7))
+//   (func (export "match") (type $returns_i32) (return_call_indirect (type $returns_i32) (i32.const 0)))
+//   (func (export "mismatch") (type $returns_i32) (return_call_indirect (type $takes_and_returns_i32) (i32.const 5) (i32.const 0))))
+test("return_call_indirect traps on a type mismatch", () => {
+    // prettier-ignore
+    const binary = new Uint8Array([
+        0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x02, 0x60, 0x00, 0x01, 0x7f, 0x60,
+        0x01, 0x7f, 0x01, 0x7f, 0x03, 0x04, 0x03, 0x00, 0x00, 0x00, 0x04, 0x04, 0x01, 0x70, 0x00, 0x01,
+        0x07, 0x14, 0x02, 0x05, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x00, 0x01, 0x08, 0x6d, 0x69, 0x73, 0x6d,
+        0x61, 0x74, 0x63, 0x68, 0x00, 0x02, 0x09, 0x07, 0x01, 0x00, 0x41, 0x00, 0x0b, 0x01, 0x00, 0x0a,
+        0x18, 0x03, 0x04, 0x00, 0x41, 0x07, 0x0b, 0x07, 0x00, 0x41, 0x00, 0x13, 0x00, 0x00, 0x0b, 0x09,
+        0x00, 0x41, 0x05, 0x41, 0x00, 0x13, 0x01, 0x00, 0x0b,
+    ]);
+    const module = parseWebAssemblyModule(binary);
+    expect(module.invoke(module.getExport("match"))).toBe(7);
+    expect(() => module.invoke(module.getExport("mismatch"))).toThrowWithMessage(
+        TypeError,
+        "Execution trapped: type_actual.parameters().size() == type_expected.parameters().size()"
+    );
+});
+
+// (module
+//   (import "spectest" "print_i32" (func $print_i32 (param i32)))
+//   (func $print_tail (param i32) (return_call $print_i32 (local.get 0)))
+//   (func (export "run") (result i32)
+//     (call $print_tail (i32.const 1))
+//     (call $print_tail (i32.const 2))
+//     (i32.const 42)))
+test("tail call to a host function", () => {
+    // prettier-ignore
+    const binary = new Uint8Array([
+        0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x09, 0x02, 0x60, 0x01, 0x7f, 0x00, 0x60,
+        0x00, 0x01, 0x7f, 0x02, 0x16, 0x01, 0x08, 0x73, 0x70, 0x65, 0x63, 0x74, 0x65, 0x73, 0x74, 0x09,
+        0x70, 0x72, 0x69, 0x6e, 0x74, 0x5f, 0x69, 0x33, 0x32, 0x00, 0x00, 0x03, 0x03, 0x02, 0x00, 0x01,
+        0x07, 0x07, 0x01, 0x03, 0x72, 0x75, 0x6e, 0x00, 0x02, 0x0a, 0x15, 0x02, 0x06, 0x00, 0x20, 0x00,
+        0x12, 0x00, 0x0b, 0x0c, 0x00, 0x41, 0x01, 0x10, 0x01, 0x41, 0x02, 0x10, 0x01, 0x41, 0x2a, 0x0b,
+    ]);
+    const module = parseWebAssemblyModule(binary);
+    // The caller's stack has to be intact after each host function returns in place of $print_tail.
+    expect(module.invoke(module.getExport("run"))).toBe(42);
+});
@@ -1107,3 +1107,11 @@ private:
 CompiledInstructions try_compile_instructions(Expression const&, Span<FunctionType const> functions);
 
 }
+
+template<>
+struct AK::Formatter<Wasm::ParseError> : public AK::Formatter<StringView> {
+    ErrorOr<void> format(FormatBuilder& builder, Wasm::ParseError error)
+    {
+        return Formatter<StringView>::format(builder, Wasm::parse_error_to_byte_string(error));
+    }
+};
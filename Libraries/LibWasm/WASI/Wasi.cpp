@@ -13,7 +13,9 @@
 #include <LibWasm/AbstractMachine/Configuration.h>
 #include <LibWasm/Wasi.h>
 #include <fcntl.h>
+#include <limits.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <time.h>
 #include <unistd.h>
 
@@ -309,10 +311,52 @@ static ErrorOr<size_t> copy_string_excluding_terminating_null(Configuration& con
     return byte_count;
 }
 
+// Describes the guest buffers in `iovs` as host iovecs pointing straight into linear memory, so a single
+// vectored syscall can move all of them without going through any intermediate buffer.
+template<typename T>
+static ErrorOr<Vector<struct iovec, 16>> guest_buffers_as_iovecs(Configuration& configuration, Pointer<T> iovs, Size iovs_len)
+{
+    Vector<struct iovec, 16> host_iovecs;
+    TRY(host_iovecs.try_ensure_capacity(iovs_len));
+    for (auto& iovec : TRY(copy_typed_array(configuration, iovs, iovs_len))) {
+        auto slice = TRY(slice_typed_memory(configuration, iovec.buf, iovec.buf_len));
+        host_iovecs.unchecked_append({ .iov_base = const_cast<void*>(static_cast<void const*>(slice.data())), .iov_len = slice.size() });
+    }
+    return host_iovecs;
+}
+
 static Errno errno_value_from_errno(int value);
 static FileType file_type_of(struct stat const& buf);
 static FDFlags fd_flags_of(struct stat const& buf);
 
+// Runs `transfer` over `iovecs` in chunks of at most IOV_MAX buffers, stopping at the first short transfer.
+// `transfer` is given the chunk and the number of bytes moved so far, which positional I/O adds to its offset.
+template<typename Transfer>
+static Result<Size> transfer_vectored(Span<struct iovec> iovecs, Transfer transfer)
+{
+    Size total = 0;
+    while (!iovecs.is_empty()) {
+        auto chunk = iovecs.trim(IOV_MAX);
+        size_t expected = 0;
+        for (auto const& iovec : chunk)
+            expected += iovec.iov_len;
+
+        auto result = transfer(chunk, static_cast<size_t>(total));
+        if (result < 0) {
+            // Like a short transfer, an error after some bytes have already been moved is reported as the partial
+            // count, so that the guest does not move those bytes again.
+            if (total > 0)
+                break;
+            return errno_value_from_errno(errno);
+        }
+        total += static_cast<Size>(result);
+        if (static_cast<size_t>(result) < expected)
+            break;
+        iovecs = iovecs.slice(chunk.size());
+    }
+    return total;
+}
+
 Vector<AK::String> const& Implementation::arguments() const
 {
     if (!cache.cached_arguments.has_value()) {
@@ -453,15 +497,10 @@ ErrorOr<Result<Size>> Implementation::impl$fd_write(Configuration& configuration
         return errno_value_from_errno(EBADF);
 
     u32 fd_value = mapped_fd.get<u32>();
-    Size bytes_written = 0;
-    for (auto& iovec : TRY(copy_typed_array(configuration, iovs, iovs_len))) {
-        auto slice = TRY(slice_typed_memory(configuration, iovec.buf, iovec.buf_len));
-        auto result = write(fd_value, slice.data(), slice.size());
-        if (result < 0)
-            return errno_value_from_errno(errno);
-        bytes_written += static_cast<Size>(result);
-    }
-    return bytes_written;
+    auto buffers = TRY(guest_buffers_as_iovecs(configuration, iovs, iovs_len));
+    return transfer_vectored(buffers, [&](Span<struct iovec> chunk, size_t) {
+        return writev(fd_value, chunk.data(), static_cast<int>(chunk.size()));
+    });
 }
 
 ErrorOr<Result<PreStat>> Implementation::impl$fd_prestat_get(Configuration&, FD fd)
@@ -766,15 +805,36 @@ ErrorOr<Result<Size>> Implementation::impl$fd_read(Configuration& configuration,
         return errno_value_from_errno(EBADF);
 
     u32 fd_value = mapped_fd.get<u32>();
-    Size bytes_read = 0;
-    for (auto& iovec : TRY(copy_typed_array(configuration, iovs, iovs_len))) {
-        auto slice = TRY(slice_typed_memory(configuration, iovec.buf, iovec.buf_len));
-        auto result = read(fd_value, slice.data(), slice.size());
-        if (result < 0)
-            return errno_value_from_errno(errno);
-        bytes_read += static_cast<Size>(result);
-    }
-    return bytes_read;
+    auto buffers = TRY(guest_buffers_as_iovecs(configuration, iovs, iovs_len));
+    return transfer_vectored(buffers, [&](Span<struct iovec> chunk, size_t) {
+        return readv(fd_value, chunk.data(), static_cast<int>(chunk.size()));
+    });
+}
+
+ErrorOr<Result<Size>> Implementation::impl$fd_pread(Configuration& configuration, FD fd, Pointer<IOVec> iovs, Size iovs_len, FileSize offset)
+{
+    auto mapped_fd = map_fd(fd);
+    if (!mapped_fd.has<u32>())
+        return errno_value_from_errno(mapped_fd.has<PreopenedDirectoryDescriptor>() ? EISDIR : EBADF);
+
+    u32 fd_value = mapped_fd.get<u32>();
+    auto buffers = TRY(guest_buffers_as_iovecs(configuration, iovs, iovs_len));
+    return transfer_vectored(buffers, [&](Span<struct iovec> chunk, size_t bytes_so_far) {
+        return preadv(fd_value, chunk.data(), static_cast<int>(chunk.size()), static_cast<off_t>(offset + bytes_so_far));
+    });
+}
+
+ErrorOr<Result<Size>> Implementation::impl$fd_pwrite(Configuration& configuration, FD fd, Pointer<CIOVec> iovs, Size iovs_len, FileSize offset)
+{
+    auto mapped_fd = map_fd(fd);
+    if (!mapped_fd.has<u32>())
+        return errno_value_from_errno(mapped_fd.has<PreopenedDirectoryDescriptor>() ? EISDIR : EBADF);
+
+    u32 fd_value = mapped_fd.get<u32>();
+    auto buffers = TRY(guest_buffers_as_iovecs(configuration, iovs, iovs_len));
+    return transfer_vectored(buffers, [&](Span<struct iovec> chunk, size_t bytes_so_far) {
+        return pwritev(fd_value, chunk.data(), static_cast<int>(chunk.size()), static_cast<off_t>(offset + bytes_so_far));
+    });
 }
 
 ErrorOr<Result<FDStat>> Implementation::impl$fd_fdstat_get(Configuration&, FD fd)
@@ -836,8 +896,6 @@ ErrorOr<Result<void>> Implementation::impl$fd_fdstat_set_flags(Configuration&, F
 ErrorOr<Result<void>> Implementation::impl$fd_fdstat_set_rights(Configuration&, FD, Rights fs_rights_base, Rights fs_rights_inheriting) { return Errno::NoSys; }
 ErrorOr<Result<void>> Implementation::impl$fd_filestat_set_size(Configuration&, FD, FileSize) { return Errno::NoSys; }
 ErrorOr<Result<void>> Implementation::impl$fd_filestat_set_times(Configuration&, FD, Timestamp atim, Timestamp mtim, FSTFlags) { return Errno::NoSys; }
-ErrorOr<Result<Size>> Implementation::impl$fd_pread(Configuration&, FD, Pointer<IOVec> iovs, Size iovs_len, FileSize offset) { return Errno::NoSys; }
-ErrorOr<Result<Size>> Implementation::impl$fd_pwrite(Configuration&, FD, Pointer<CIOVec> iovs, Size iovs_len, FileSize offset) { return Errno::NoSys; }
 ErrorOr<Result<Size>> Implementation::impl$fd_readdir(Configuration&, FD, Pointer<u8> buf, Size buf_len, DirCookie cookie) { return Errno::NoSys; }
 ErrorOr<Result<void>> Implementation::impl$fd_renumber(Configuration&, FD from, FD to) { return Errno::NoSys; }
 ErrorOr<Result<void>> Implementation::impl$fd_sync(Configuration&, FD) { return Errno::NoSys; }
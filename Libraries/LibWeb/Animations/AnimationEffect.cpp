@@ -14,8 +14,10 @@
 #include <LibWeb/CSS/ComputedProperties.h>
 #include <LibWeb/CSS/Parser/Parser.h>
 #include <LibWeb/CSS/StyleInvalidation.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/Layout/Node.h>
+#include <LibWeb/Painting/PaintableBox.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
 
 namespace Web::Animations {
@@ -631,8 +633,16 @@ void AnimationEffect::visit_edges(JS::Cell::Visitor& visitor)
     visitor.visit(m_associated_animation);
 }
 
-static CSS::RequiredInvalidationAfterStyleChange compute_required_invalidation_for_animated_properties(HashMap<CSS::PropertyID, NonnullRefPtr<CSS::StyleValue const>> const& old_properties, HashMap<CSS::PropertyID, NonnullRefPtr<CSS::StyleValue const>> const& new_properties)
+// These properties are applied by the PushStackingContext command of the element's stacking context, so a change to
+// them can be rendered by replaying the cached display list with new values.
+static bool is_applied_by_stacking_context(CSS::PropertyID property_id)
 {
+    return first_is_one_of(property_id, CSS::PropertyID::Opacity, CSS::PropertyID::Transform, CSS::PropertyID::Rotate, CSS::PropertyID::Scale, CSS::PropertyID::Translate);
+}
+
+static CSS::RequiredInvalidationAfterStyleChange compute_required_invalidation_for_animated_properties(HashMap<CSS::PropertyID, NonnullRefPtr<CSS::StyleValue const>> const& old_properties, HashMap<CSS::PropertyID, NonnullRefPtr<CSS::StyleValue const>> const& new_properties, bool& only_stacking_context_properties_changed)
+{
+    only_stacking_context_properties_changed = true;
     CSS::RequiredInvalidationAfterStyleChange invalidation;
     auto old_and_new_properties = MUST(Bitmap::create(to_underlying(CSS::last_property_id) + 1, 0));
     for (auto const& [property_id, _] : old_properties)
@@ -647,7 +657,10 @@ static CSS::RequiredInvalidationAfterStyleChange compute_required_invalidation_f
         auto const* new_value = new_properties.get(property_id).value_or({});
         if (!old_value && !new_value)
             continue;
-        invalidation |= compute_property_invalidation(property_id, old_value, new_value);
+        auto property_invalidation = compute_property_invalidation(property_id, old_value, new_value);
+        if (!property_invalidation.is_none() && !is_applied_by_stacking_context(property_id))
+            only_stacking_context_properties_changed = false;
+        invalidation |= property_invalidation;
     }
     return invalidation;
 }
@@ -660,7 +673,8 @@ AnimationUpdateContext::~AnimationUpdateContext()
             continue;
         auto& element = it.key;
         GC::Ref<DOM::Element> target = element.element();
-        auto invalidation = compute_required_invalidation_for_animated_properties(it.value->animated_properties_before_update, style->animated_property_values());
+        bool only_stacking_context_properties_changed = false;
+        auto invalidation = compute_required_invalidation_for_animated_properties(it.value->animated_properties_before_update, style->animated_property_values(), only_stacking_context_properties_changed);
 
         if (invalidation.is_none())
             continue;
@@ -671,6 +685,7 @@ AnimationUpdateContext::~AnimationUpdateContext()
             if (element_invalidation.is_none())
                 return TraversalDecision::SkipChildrenAndContinue;
             invalidation |= element_invalidation;
+            only_stacking_context_properties_changed = false;
             return TraversalDecision::Continue;
         });
 
@@ -694,8 +709,16 @@ AnimationUpdateContext::~AnimationUpdateContext()
             }
         }
         if (invalidation.repaint) {
-            element.document().set_needs_display();
-            element.document().set_needs_to_resolve_paint_only_properties();
+            auto* paintable_box = !element.pseudo_element().has_value() ? target->paintable_box() : nullptr;
+            if (only_stacking_context_properties_changed && !invalidation.relayout && !invalidation.rebuild_layout_tree && !invalidation.rebuild_stacking_context_tree
+                && paintable_box && paintable_box->stacking_context()) {
+                // OPTIMIZATION: Only the opacity or transform of an existing stacking context changed, which doesn't
+                //               require recording a new display list.
+                element.document().did_animate_stacking_context(*paintable_box);
+            } else {
+                element.document().set_needs_display();
+                element.document().set_needs_to_resolve_paint_only_properties();
+            }
         }
         if (invalidation.rebuild_stacking_context_tree)
             element.document().invalidate_stacking_context_tree();
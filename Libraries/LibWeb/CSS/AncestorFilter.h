@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2024-2025, Andreas Kling <andreas@ladybird.org>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NumericLimits.h>
+#include <AK/Types.h>
+#include <LibWeb/CSS/Selector.h>
+#include <LibWeb/DOM/Element.h>
+
+namespace Web::CSS {
+
+// A counting bloom filter with 2 hash functions.
+// NOTE: If a counter overflows, it's kept maxed-out until the whole filter is cleared.
+template<typename CounterType, size_t key_bits>
+class CountingBloomFilter {
+public:
+    CountingBloomFilter() { }
+
+    void clear() { __builtin_memset(m_buckets, 0, sizeof(m_buckets)); }
+
+    void increment(u32 key)
+    {
+        auto& first = bucket1(key);
+        if (first < NumericLimits<CounterType>::max())
+            ++first;
+        auto& second = bucket2(key);
+        if (second < NumericLimits<CounterType>::max())
+            ++second;
+    }
+
+    void decrement(u32 key)
+    {
+        auto& first = bucket1(key);
+        if (first < NumericLimits<CounterType>::max())
+            --first;
+        auto& second = bucket2(key);
+        if (second < NumericLimits<CounterType>::max())
+            --second;
+    }
+
+    [[nodiscard]] bool may_contain(u32 hash) const
+    {
+        return bucket1(hash) && bucket2(hash);
+    }
+
+private:
+    static constexpr u32 bucket_count = 1 << key_bits;
+    static constexpr u32 key_mask = bucket_count - 1;
+
+    [[nodiscard]] u32 hash1(u32 key) const { return key & key_mask; }
+    [[nodiscard]] u32 hash2(u32 key) const { return (key >> 16) & key_mask; }
+
+    [[nodiscard]] CounterType& bucket1(u32 key) { return m_buckets[hash1(key)]; }
+    [[nodiscard]] CounterType& bucket2(u32 key) { return m_buckets[hash2(key)]; }
+    [[nodiscard]] CounterType bucket1(u32 key) const { return m_buckets[hash1(key)]; }
+    [[nodiscard]] CounterType bucket2(u32 key) const { return m_buckets[hash2(key)]; }
+
+    CounterType m_buckets[bucket_count];
+};
+
+// Remembers the tag names, ids, classes and attribute names of the ancestors of the element whose style is being
+// computed, so that selectors requiring an ancestor that isn't there can be rejected without walking up the tree.
+// The filter describes a position in one particular tree walk, so every walk that computes style needs its own.
+class AncestorFilter {
+public:
+    void clear() { m_filter.clear(); }
+
+    // NOTE: These are defined inline, as they run for every element of a style computing tree walk, and should_reject()
+    //       runs for every rule that could match each of those elements.
+    void push(DOM::Element const& element)
+    {
+        for_each_element_hash(element, [&](u32 hash) {
+            m_filter.increment(hash);
+        });
+    }
+
+    void pop(DOM::Element const& element)
+    {
+        for_each_element_hash(element, [&](u32 hash) {
+            m_filter.decrement(hash);
+        });
+    }
+
+    [[nodiscard]] bool should_reject(Selector const& selector) const
+    {
+        for (u32 hash : selector.ancestor_hashes()) {
+            if (hash == 0)
+                break;
+            if (!m_filter.may_contain(hash))
+                return true;
+        }
+        return false;
+    }
+
+private:
+    static void for_each_element_hash(DOM::Element const& element, auto callback)
+    {
+        callback(element.local_name().ascii_case_insensitive_hash());
+        if (element.id().has_value())
+            callback(element.id().value().hash());
+        for (auto const& class_ : element.class_names())
+            callback(class_.hash());
+        element.for_each_attribute([&](auto& attribute) {
+            callback(attribute.lowercase_name().hash());
+        });
+    }
+
+    CountingBloomFilter<u8, 14> m_filter;
+};
+
+}
@@ -158,7 +158,15 @@ WebIDL::ExceptionOr<unsigned> CSSStyleSheet::insert_rule(StringView rule, unsign
         // NOTE: The spec doesn't say where to set the parent style sheet, so we'll do it here.
         parsed_rule->set_parent_style_sheet(this);
 
-        invalidate_owners(DOM::StyleInvalidationReason::StyleSheetInsertRule);
+        // Appending a style rule leaves the cascade order of every other rule untouched, so the document's rule caches
+        // can take it in as-is and only the elements that it could match need their style recomputed.
+        auto* style_computer = style_computer_for_incremental_rule_update();
+        bool updated_incrementally = style_computer
+            && parsed_rule->type() == CSSRule::Type::Style
+            && result.value() == m_rules->length() - 1
+            && style_computer->did_append_style_rule(*this, static_cast<CSSStyleRule const&>(*parsed_rule));
+        if (!updated_incrementally)
+            invalidate_owners(DOM::StyleInvalidationReason::StyleSheetInsertRule);
     }
 
     return result;
@@ -173,10 +181,18 @@ WebIDL::ExceptionOr<void> CSSStyleSheet::delete_rule(unsigned index)
     if (disallow_modification())
         return WebIDL::NotAllowedError::create(realm(), "Can't call delete_rule() on non-modifiable stylesheets."_utf16);
 
+    // NOTE: Keep the rule alive so we can tell the style computer which rule went away.
+    GC::Ptr<CSSRule> removed_rule = m_rules->item(index);
+
     // 3. Remove a CSS rule in the CSS rules at index.
     auto result = m_rules->remove_a_css_rule(index);
     if (!result.is_exception()) {
-        invalidate_owners(DOM::StyleInvalidationReason::StyleSheetDeleteRule);
+        auto* style_computer = style_computer_for_incremental_rule_update();
+        bool updated_incrementally = style_computer
+            && removed_rule->type() == CSSRule::Type::Style
+            && style_computer->did_remove_style_rule(*this, static_cast<CSSStyleRule const&>(*removed_rule));
+        if (!updated_incrementally)
+            invalidate_owners(DOM::StyleInvalidationReason::StyleSheetDeleteRule);
     }
     return result;
 }
@@ -337,6 +353,18 @@ void CSSStyleSheet::invalidate_owners(DOM::StyleInvalidationReason reason)
     }
 }
 
+StyleComputer* CSSStyleSheet::style_computer_for_incremental_rule_update()
+{
+    // NOTE: Only style sheets that apply directly to a single document get their rules tracked individually in the
+    //       rule caches; everything else has to go through a full rule cache rebuild.
+    if (m_owning_documents_or_shadow_roots.size() != 1)
+        return nullptr;
+    auto& owner = **m_owning_documents_or_shadow_roots.begin();
+    if (!owner.is_document())
+        return nullptr;
+    return &owner.document().style_computer();
+}
+
 GC::Ptr<DOM::Document> CSSStyleSheet::owning_document() const
 {
     if (!m_owning_documents_or_shadow_roots.is_empty())
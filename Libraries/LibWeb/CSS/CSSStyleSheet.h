@@ -109,6 +109,7 @@ private:
     void set_disallow_modification(bool disallow_modification) { m_disallow_modification = disallow_modification; }
 
     Parser::ParsingParams make_parsing_params() const;
+    StyleComputer* style_computer_for_incremental_rule_update();
 
     Optional<String> m_source_text;
 
@@ -13,8 +13,10 @@
 
 namespace Web::CSS {
 
+using PercentageBasis = Variant<Empty, Angle, Frequency, Length, Time>;
+
 struct CalculationResolutionContext {
-    Variant<Empty, Angle, Frequency, Length, Time> percentage_basis {};
+    PercentageBasis percentage_basis {};
     Optional<Length::ResolutionContext> length_resolution_context;
 };
 
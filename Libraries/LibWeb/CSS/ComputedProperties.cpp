@@ -44,6 +44,43 @@ namespace Web::CSS {
 
 GC_DEFINE_ALLOCATOR(ComputedProperties);
 
+NonnullRefPtr<PropertyValueGroup> PropertyValueGroup::clone() const
+{
+    auto clone = create();
+    clone->m_values = m_values;
+    return clone;
+}
+
+unsigned PropertyValueGroup::hash() const
+{
+    unsigned hash = 0;
+    for (auto const& value : m_values)
+        hash = pair_int_hash(hash, ptr_hash(value.ptr()));
+    return hash;
+}
+
+bool PropertyValueGroup::operator==(PropertyValueGroup const& other) const
+{
+    for (size_t i = 0; i < size; ++i) {
+        if (m_values[i].ptr() != other.m_values[i].ptr())
+            return false;
+    }
+    return true;
+}
+
+NonnullRefPtr<PropertyValueGroup> PropertyValueGroupCache::intern(NonnullRefPtr<PropertyValueGroup> group)
+{
+    auto hash = group->hash();
+    if (auto it = m_groups.find(hash, [&](auto const& entry) { return *entry == *group; }); it != m_groups.end())
+        return *it;
+
+    // Entries keep their groups alive, so start over rather than let the cache grow with every distinct style seen.
+    if (m_groups.size() >= max_size)
+        m_groups.clear();
+    m_groups.set(group);
+    return group;
+}
+
 ComputedProperties::ComputedProperties() = default;
 
 ComputedProperties::~ComputedProperties() = default;
@@ -55,6 +92,25 @@ void ComputedProperties::visit_edges(Visitor& visitor)
     visitor.visit(m_transition_property_source);
 }
 
+GC::Ref<ComputedProperties> ComputedProperties::clone() const
+{
+    auto clone = heap().allocate<ComputedProperties>();
+    clone->m_animation_name_source = m_animation_name_source;
+    clone->m_transition_property_source = m_transition_property_source;
+    clone->m_property_groups = m_property_groups;
+    clone->m_property_important = m_property_important;
+    clone->m_property_inherited = m_property_inherited;
+    clone->m_animated_property_inherited = m_animated_property_inherited;
+    clone->m_animated_property_values = m_animated_property_values;
+    clone->m_math_depth = m_math_depth;
+    clone->m_font_list = m_font_list;
+    clone->m_first_available_computed_font = m_first_available_computed_font;
+    clone->m_line_height = m_line_height;
+    clone->m_font_size = m_font_size;
+    clone->m_attempted_pseudo_class_matches = m_attempted_pseudo_class_matches;
+    return clone;
+}
+
 bool ComputedProperties::is_property_important(PropertyID property_id) const
 {
     size_t n = to_underlying(property_id);
@@ -100,16 +156,46 @@ void ComputedProperties::set_animated_property_inherited(PropertyID property_id,
         m_animated_property_inherited[n / 8] &= ~(1 << (n % 8));
 }
 
+void ComputedProperties::set_value_slot(PropertyID id, RefPtr<StyleValue const> value)
+{
+    auto [group_index, index] = group_slot_for(id);
+    auto& group = m_property_groups[group_index];
+    if (!group) {
+        if (!value)
+            return;
+        group = PropertyValueGroup::create();
+    } else if ((*group)[index].ptr() == value.ptr()) {
+        return;
+    } else if (group->ref_count() > 1) {
+        group = group->clone();
+    }
+    (*group)[index] = move(value);
+}
+
+void ComputedProperties::share_property_groups(Badge<StyleComputer>, ComputedProperties const* parent, PropertyValueGroupCache& cache)
+{
+    for (size_t i = 0; i < number_of_property_groups; ++i) {
+        auto& group = m_property_groups[i];
+        if (!group)
+            continue;
+        if (parent && parent->m_property_groups[i] && *parent->m_property_groups[i] == *group) {
+            group = parent->m_property_groups[i];
+            continue;
+        }
+        group = cache.intern(group.release_nonnull());
+    }
+}
+
 void ComputedProperties::set_property(PropertyID id, NonnullRefPtr<StyleValue const> value, Inherited inherited, Important important)
 {
-    m_property_values[to_underlying(id)] = move(value);
+    set_value_slot(id, move(value));
     set_property_important(id, important);
     set_property_inherited(id, inherited);
 }
 
 void ComputedProperties::revert_property(PropertyID id, ComputedProperties const& style_for_revert)
 {
-    m_property_values[to_underlying(id)] = style_for_revert.m_property_values[to_underlying(id)];
+    set_value_slot(id, style_for_revert.value_slot(id));
     set_property_important(id, style_for_revert.is_property_important(id) ? Important::Yes : Important::No);
     set_property_inherited(id, style_for_revert.is_property_inherited(id) ? Inherited::Yes : Inherited::No);
 }
@@ -138,14 +224,14 @@ StyleValue const& ComputedProperties::property(PropertyID property_id, WithAnima
     }
 
     // By the time we call this method, all properties have values assigned.
-    return *m_property_values[to_underlying(property_id)];
+    return *value_slot(property_id);
 }
 
 StyleValue const* ComputedProperties::maybe_null_property(PropertyID property_id) const
 {
     if (auto animated_value = m_animated_property_values.get(property_id); animated_value.has_value())
         return animated_value.value();
-    return m_property_values[to_underlying(property_id)];
+    return value_slot(property_id);
 }
 
 Variant<LengthPercentage, NormalGap> ComputedProperties::gap_value(PropertyID id) const
@@ -787,12 +873,13 @@ Positioning ComputedProperties::position() const
 
 bool ComputedProperties::operator==(ComputedProperties const& other) const
 {
-    if (m_property_values.size() != other.m_property_values.size())
-        return false;
-
-    for (size_t i = 0; i < m_property_values.size(); ++i) {
-        auto const& my_style = m_property_values[i];
-        auto const& other_style = other.m_property_values[i];
+    for (size_t i = 0; i < number_of_properties; ++i) {
+        auto property_id = static_cast<PropertyID>(i);
+        auto group_index = group_slot_for(property_id).group;
+        if (m_property_groups[group_index] == other.m_property_groups[group_index])
+            continue;
+        auto const* my_style = value_slot(property_id);
+        auto const* other_style = other.value_slot(property_id);
         if (!my_style) {
             if (other_style)
                 return false;
@@ -1819,6 +1906,35 @@ Containment ComputedProperties::contain() const
     return containment;
 }
 
+static ContainIntrinsicSize contain_intrinsic_size_from_style_value(StyleValue const& style_value, Layout::Node const& layout_node)
+{
+    auto resolve_value = [&](StyleValue const& value) -> Optional<Length> {
+        if (value.is_length())
+            return value.as_length().length();
+        if (value.is_calculated())
+            return value.as_calculated().resolve_length_deprecated({ .length_resolution_context = Length::ResolutionContext::for_layout_node(layout_node) }).value_or(Length(0, Length::Type::Px));
+        return {};
+    };
+
+    // auto? [ none | <length [0,∞]> ]
+    if (style_value.is_value_list()) {
+        auto const& values = style_value.as_value_list().values();
+        VERIFY(values.size() == 2);
+        return { .use_last_remembered_size = true, .length = resolve_value(*values[1]) };
+    }
+    return { .use_last_remembered_size = false, .length = resolve_value(style_value) };
+}
+
+ContainIntrinsicSize ComputedProperties::contain_intrinsic_width(Layout::Node const& layout_node) const
+{
+    return contain_intrinsic_size_from_style_value(property(PropertyID::ContainIntrinsicWidth), layout_node);
+}
+
+ContainIntrinsicSize ComputedProperties::contain_intrinsic_height(Layout::Node const& layout_node) const
+{
+    return contain_intrinsic_size_from_style_value(property(PropertyID::ContainIntrinsicHeight), layout_node);
+}
+
 MixBlendMode ComputedProperties::mix_blend_mode() const
 {
     auto const& value = property(PropertyID::MixBlendMode);
@@ -8,7 +8,9 @@
 #pragma once
 
 #include <AK/HashMap.h>
+#include <AK/HashTable.h>
 #include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/Ptr.h>
 #include <LibGfx/Font/Font.h>
@@ -24,6 +26,46 @@
 
 namespace Web::CSS {
 
+// A run of consecutive computed values. Groups are shared by any number of ComputedProperties (siblings with the same
+// style, or a child that inherits everything in the group from its parent) until one of them writes to it.
+class PropertyValueGroup final : public RefCounted<PropertyValueGroup> {
+public:
+    static constexpr size_t size = 32;
+
+    static NonnullRefPtr<PropertyValueGroup> create() { return adopt_ref(*new PropertyValueGroup); }
+    NonnullRefPtr<PropertyValueGroup> clone() const;
+
+    RefPtr<StyleValue const> const& operator[](size_t index) const { return m_values[index]; }
+    RefPtr<StyleValue const>& operator[](size_t index) { return m_values[index]; }
+
+    // Groups are compared by the identity of their values, which is what makes sharing them cheap enough to do for
+    // every element: values that come from the same declaration, the initial value or the parent are the same object.
+    unsigned hash() const;
+    bool operator==(PropertyValueGroup const&) const;
+
+private:
+    PropertyValueGroup() = default;
+
+    Array<RefPtr<StyleValue const>, size> m_values;
+};
+
+struct PropertyValueGroupTraits : public DefaultTraits<NonnullRefPtr<PropertyValueGroup>> {
+    static unsigned hash(NonnullRefPtr<PropertyValueGroup> const& group) { return group->hash(); }
+    static bool equals(NonnullRefPtr<PropertyValueGroup> const& a, NonnullRefPtr<PropertyValueGroup> const& b) { return *a == *b; }
+};
+
+// Hands out a single shared instance for each distinct group of values.
+class PropertyValueGroupCache {
+public:
+    NonnullRefPtr<PropertyValueGroup> intern(NonnullRefPtr<PropertyValueGroup>);
+    void clear() { m_groups.clear(); }
+
+private:
+    static constexpr size_t max_size = 2048;
+
+    HashTable<NonnullRefPtr<PropertyValueGroup>, PropertyValueGroupTraits> m_groups;
+};
+
 class ComputedProperties final : public JS::Cell {
     GC_CELL(ComputedProperties, JS::Cell);
     GC_DECLARE_ALLOCATOR(ComputedProperties);
@@ -37,9 +79,9 @@ public:
     template<typename Callback>
     inline void for_each_property(Callback callback) const
     {
-        for (size_t i = 0; i < m_property_values.size(); ++i) {
-            if (m_property_values[i])
-                callback((PropertyID)i, *m_property_values[i]);
+        for (size_t i = 0; i < number_of_properties; ++i) {
+            if (auto const* value = value_slot(static_cast<PropertyID>(i)))
+                callback(static_cast<PropertyID>(i), *value);
         }
     }
 
@@ -177,6 +219,8 @@ public:
     Isolation isolation() const;
     TouchActionData touch_action() const;
     Containment contain() const;
+    ContainIntrinsicSize contain_intrinsic_width(Layout::Node const&) const;
+    ContainIntrinsicSize contain_intrinsic_height(Layout::Node const&) const;
     MixBlendMode mix_blend_mode() const;
     Optional<FlyString> view_transition_name() const;
 
@@ -252,14 +296,56 @@ public:
         return m_attempted_pseudo_class_matches.get(pseudo_class);
     }
 
+    bool has_attempted_any_pseudo_class_match() const { return !m_attempted_pseudo_class_matches.is_empty(); }
+
     void set_attempted_pseudo_class_matches(PseudoClassBitmap const& results)
     {
         m_attempted_pseudo_class_matches = results;
     }
 
+    [[nodiscard]] GC::Ref<ComputedProperties> clone() const;
+
+    // Replaces each group of values with an identical one from the parent or the cache, so that elements with the same
+    // values share storage.
+    void share_property_groups(Badge<StyleComputer>, ComputedProperties const* parent, PropertyValueGroupCache&);
+
 private:
     friend class StyleComputer;
 
+    // Shorthands, inherited longhands and non-inherited longhands are each split into their own groups, so that an
+    // element inheriting all of its inherited properties can share those groups with its parent.
+    static constexpr size_t first_inherited_longhand_index = to_underlying(first_inherited_longhand_property_id);
+    static constexpr size_t first_non_inherited_longhand_index = to_underlying(last_inherited_longhand_property_id) + 1;
+    static constexpr size_t first_inherited_longhand_group = ceil_div(first_inherited_longhand_index, PropertyValueGroup::size);
+    static constexpr size_t first_non_inherited_longhand_group = first_inherited_longhand_group + ceil_div(first_non_inherited_longhand_index - first_inherited_longhand_index, PropertyValueGroup::size);
+    static constexpr size_t number_of_property_groups = first_non_inherited_longhand_group + ceil_div(number_of_properties - first_non_inherited_longhand_index, PropertyValueGroup::size);
+
+    struct GroupSlot {
+        size_t group;
+        size_t index;
+    };
+    static constexpr GroupSlot group_slot_for(PropertyID property_id)
+    {
+        size_t n = to_underlying(property_id);
+        if (n < first_inherited_longhand_index)
+            return { n / PropertyValueGroup::size, n % PropertyValueGroup::size };
+        if (n < first_non_inherited_longhand_index) {
+            n -= first_inherited_longhand_index;
+            return { first_inherited_longhand_group + n / PropertyValueGroup::size, n % PropertyValueGroup::size };
+        }
+        n -= first_non_inherited_longhand_index;
+        return { first_non_inherited_longhand_group + n / PropertyValueGroup::size, n % PropertyValueGroup::size };
+    }
+
+    StyleValue const* value_slot(PropertyID property_id) const
+    {
+        auto [group, index] = group_slot_for(property_id);
+        if (!m_property_groups[group])
+            return nullptr;
+        return (*m_property_groups[group])[index].ptr();
+    }
+    void set_value_slot(PropertyID, RefPtr<StyleValue const>);
+
     ComputedProperties();
 
     virtual void visit_edges(Visitor&) override;
@@ -270,7 +356,7 @@ private:
     GC::Ptr<CSSStyleDeclaration const> m_animation_name_source;
     GC::Ptr<CSSStyleDeclaration const> m_transition_property_source;
 
-    Array<RefPtr<StyleValue const>, number_of_properties> m_property_values;
+    Array<RefPtr<PropertyValueGroup>, number_of_property_groups> m_property_groups;
     Array<u8, ceil_div(number_of_properties, 8uz)> m_property_important {};
     Array<u8, ceil_div(number_of_properties, 8uz)> m_property_inherited {};
     Array<u8, ceil_div(number_of_properties, 8uz)> m_animated_property_inherited {};
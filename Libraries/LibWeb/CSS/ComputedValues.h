@@ -82,6 +82,14 @@ struct Containment {
     bool is_empty() const { return !(size_containment || inline_size_containment || layout_containment || style_containment || paint_containment); }
 };
 
+// https://drafts.csswg.org/css-sizing-4/#intrinsic-size-override
+struct ContainIntrinsicSize {
+    // `auto`: use the last remembered size of the element if it has one.
+    bool use_last_remembered_size { false };
+    // Empty for `none`.
+    Optional<Length> length;
+};
+
 struct ScrollbarColorData {
     Color thumb_color { Color::Transparent };
     Color track_color { Color::Transparent };
@@ -233,6 +241,7 @@ public:
     static CSS::UserSelect user_select() { return CSS::UserSelect::Auto; }
     static CSS::Isolation isolation() { return CSS::Isolation::Auto; }
     static CSS::Containment contain() { return {}; }
+    static CSS::ContainIntrinsicSize contain_intrinsic_size() { return {}; }
     static CSS::MixBlendMode mix_blend_mode() { return CSS::MixBlendMode::Normal; }
     static Optional<int> z_index() { return OptionalNone(); }
 
@@ -537,6 +546,8 @@ public:
     CSS::UserSelect user_select() const { return m_noninherited.user_select; }
     CSS::Isolation isolation() const { return m_noninherited.isolation; }
     CSS::Containment const& contain() const { return m_noninherited.contain; }
+    CSS::ContainIntrinsicSize const& contain_intrinsic_width() const { return m_noninherited.contain_intrinsic_width; }
+    CSS::ContainIntrinsicSize const& contain_intrinsic_height() const { return m_noninherited.contain_intrinsic_height; }
     CSS::MixBlendMode mix_blend_mode() const { return m_noninherited.mix_blend_mode; }
     Optional<FlyString> view_transition_name() const { return m_noninherited.view_transition_name; }
     TouchActionData touch_action() const { return m_noninherited.touch_action; }
@@ -809,6 +820,8 @@ protected:
         CSS::UserSelect user_select { InitialValues::user_select() };
         CSS::Isolation isolation { InitialValues::isolation() };
         CSS::Containment contain { InitialValues::contain() };
+        CSS::ContainIntrinsicSize contain_intrinsic_width { InitialValues::contain_intrinsic_size() };
+        CSS::ContainIntrinsicSize contain_intrinsic_height { InitialValues::contain_intrinsic_size() };
         CSS::MixBlendMode mix_blend_mode { InitialValues::mix_blend_mode() };
         WhiteSpaceTrimData white_space_trim;
         Optional<FlyString> view_transition_name;
@@ -1002,6 +1015,8 @@ public:
     void set_user_select(CSS::UserSelect value) { m_noninherited.user_select = value; }
     void set_isolation(CSS::Isolation value) { m_noninherited.isolation = value; }
     void set_contain(CSS::Containment value) { m_noninherited.contain = move(value); }
+    void set_contain_intrinsic_width(CSS::ContainIntrinsicSize value) { m_noninherited.contain_intrinsic_width = move(value); }
+    void set_contain_intrinsic_height(CSS::ContainIntrinsicSize value) { m_noninherited.contain_intrinsic_height = move(value); }
     void set_mix_blend_mode(CSS::MixBlendMode value) { m_noninherited.mix_blend_mode = value; }
     void set_view_transition_name(Optional<FlyString> value) { m_noninherited.view_transition_name = value; }
     void set_touch_action(TouchActionData value) { m_noninherited.touch_action = value; }
@@ -51,6 +51,10 @@ GC::Ref<CSS::CSSStyleSheet> parse_css_stylesheet(CSS::Parser::ParsingParams cons
         style_sheet->set_source_text({});
         return style_sheet;
     }
+    // Style sheets without a location can't be told apart.
+    if (location.has_value())
+        return CSS::Parser::Parser::parse_as_css_stylesheet_using_cache(context, css, *location, move(media_query_list));
+
     auto style_sheet = CSS::Parser::Parser::create(context, css).parse_as_css_stylesheet(location, move(media_query_list));
     // FIXME: Avoid this copy
     style_sheet->set_source_text(MUST(String::from_utf8(css)));
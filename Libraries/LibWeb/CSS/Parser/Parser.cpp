@@ -13,6 +13,7 @@
  */
 
 #include <AK/Debug.h>
+#include <AK/IntrusiveList.h>
 #include <LibURL/Parser.h>
 #include <LibWeb/CSS/CSSMarginRule.h>
 #include <LibWeb/CSS/CSSStyleDeclaration.h>
@@ -181,6 +182,120 @@ GC::Ref<CSS::CSSStyleSheet> Parser::parse_as_css_stylesheet(Optional<::URL::URL>
     return CSSStyleSheet::create(realm(), rule_list, media_list, move(location));
 }
 
+namespace {
+
+struct CachedStyleSheetKey {
+    ::URL::URL location;
+    u32 source_text_hash { 0 };
+
+    // The parts of the parsing context that could make the same source text parse differently.
+    ParsingMode mode { ParsingMode::Normal };
+    bool in_quirks_mode { false };
+    bool has_document { false };
+
+    bool operator==(CachedStyleSheetKey const&) const = default;
+};
+
+struct CachedStyleSheetKeyTraits : DefaultTraits<CachedStyleSheetKey> {
+    static unsigned hash(CachedStyleSheetKey const& key)
+    {
+        auto context_hash = (to_underlying(key.mode) << 2) | (key.in_quirks_mode << 1) | key.has_document;
+        return pair_int_hash(pair_int_hash(Traits<::URL::URL>::hash(key.location), key.source_text_hash), context_hash);
+    }
+};
+
+struct CachedStyleSheet : RefCounted<CachedStyleSheet> {
+    CachedStyleSheetKey key;
+    String source_text;
+    Vector<Rule> rules;
+    size_t estimated_size { 0 };
+
+    IntrusiveListNode<CachedStyleSheet> list_node;
+};
+
+}
+
+// The syntax-level rules don't depend on the document or realm they're parsed for, so they can be shared by all of them.
+static HashMap<CachedStyleSheetKey, NonnullRefPtr<CachedStyleSheet>, CachedStyleSheetKeyTraits> s_style_sheet_cache;
+// The cached style sheets in order of last use, so that the least recently used ones are evicted first.
+static IntrusiveList<&CachedStyleSheet::list_node> s_style_sheet_cache_by_last_use;
+static size_t s_style_sheet_cache_size { 0 };
+static constexpr size_t style_sheet_cache_max_size = 64 * MiB;
+
+// Every token of the source text becomes a ComponentValue of its own, so the parsed rules take up many times as much
+// memory as the text they came from. Walking them to add it all up would cost about as much as a cache hit saves.
+static constexpr size_t estimated_parsed_size_per_source_text_byte = 16;
+
+static size_t estimated_cached_style_sheet_size(size_t source_text_length)
+{
+    return source_text_length * (1 + estimated_parsed_size_per_source_text_byte);
+}
+
+static void evict_from_style_sheet_cache(CachedStyleSheet& style_sheet)
+{
+    // NOTE: The cache may hold the last reference, and the key has to outlive the removal from it.
+    NonnullRefPtr protector = style_sheet;
+    s_style_sheet_cache_by_last_use.remove(style_sheet);
+    s_style_sheet_cache_size -= style_sheet.estimated_size;
+    s_style_sheet_cache.remove(style_sheet.key);
+}
+
+GC::Ref<CSS::CSSStyleSheet> Parser::parse_as_css_stylesheet_using_cache(ParsingParams const& context, StringView input, ::URL::URL const& location, Vector<NonnullRefPtr<MediaQuery>> media_query_list)
+{
+    // Style sheets parsed within some outer rule or with namespaces already declared aren't worth caching.
+    if (!context.rule_context.is_empty() || !context.declared_namespaces.is_empty()) {
+        auto style_sheet = Parser::create(context, input).parse_as_css_stylesheet(location, move(media_query_list));
+        style_sheet->set_source_text(MUST(String::from_utf8(input)));
+        return style_sheet;
+    }
+
+    CachedStyleSheetKey key {
+        .location = location,
+        .source_text_hash = input.hash(),
+        .mode = context.mode,
+        .in_quirks_mode = context.document && context.document->in_quirks_mode(),
+        .has_document = context.document != nullptr,
+    };
+
+    auto cached_style_sheet = [&] -> NonnullRefPtr<CachedStyleSheet> {
+        if (auto cached = s_style_sheet_cache.get(key); cached.has_value()) {
+            NonnullRefPtr style_sheet = *cached;
+            // NOTE: Only the hash of the source text is part of the key, so make sure that it's actually the same text.
+            if (style_sheet->source_text.bytes_as_string_view() == input) {
+                s_style_sheet_cache_by_last_use.remove(*style_sheet);
+                s_style_sheet_cache_by_last_use.append(*style_sheet);
+                return style_sheet;
+            }
+            evict_from_style_sheet_cache(*style_sheet);
+        }
+
+        auto parser = Parser::create(context, input);
+        auto style_sheet = adopt_ref(*new CachedStyleSheet);
+        style_sheet->key = key;
+        style_sheet->source_text = MUST(String::from_utf8(input));
+        style_sheet->rules = parser.parse_a_stylesheet(parser.m_token_stream, location).rules;
+        style_sheet->estimated_size = estimated_cached_style_sheet_size(input.length());
+
+        if (style_sheet->estimated_size > style_sheet_cache_max_size)
+            return style_sheet;
+
+        while (s_style_sheet_cache_size + style_sheet->estimated_size > style_sheet_cache_max_size)
+            evict_from_style_sheet_cache(*s_style_sheet_cache_by_last_use.first());
+
+        s_style_sheet_cache.set(key, style_sheet);
+        s_style_sheet_cache_by_last_use.append(*style_sheet);
+        s_style_sheet_cache_size += style_sheet->estimated_size;
+        return style_sheet;
+    }();
+
+    Parser parser { context, {} };
+    auto rule_list = CSSRuleList::create(parser.realm(), parser.convert_rules(cached_style_sheet->rules));
+    auto media_list = MediaList::create(parser.realm(), move(media_query_list));
+    auto style_sheet = CSSStyleSheet::create(parser.realm(), rule_list, media_list, location);
+    style_sheet->set_source_text(cached_style_sheet->source_text);
+    return style_sheet;
+}
+
 RefPtr<Supports> Parser::parse_as_supports()
 {
     return parse_a_supports(m_token_stream);
@@ -96,6 +96,10 @@ public:
 
     GC::RootVector<GC::Ref<CSSRule>> convert_rules(Vector<Rule> const& raw_rules);
     GC::Ref<CSS::CSSStyleSheet> parse_as_css_stylesheet(Optional<::URL::URL> location, Vector<NonnullRefPtr<MediaQuery>> media_query_list = {});
+    // Like parse_as_css_stylesheet(), but the syntax-level rules are shared between all the style sheets with the same
+    // location and source text that are parsed by this process, so that e.g. a CSS framework used by several documents,
+    // or loaded again after a navigation, is only tokenized and consumed once.
+    static GC::Ref<CSS::CSSStyleSheet> parse_as_css_stylesheet_using_cache(ParsingParams const&, StringView input, ::URL::URL const& location, Vector<NonnullRefPtr<MediaQuery>> media_query_list = {});
 
     struct PropertiesAndCustomProperties {
         Vector<StyleProperty> properties;
@@ -392,6 +396,8 @@ private:
     RefPtr<PositionStyleValue const> parse_position_value(TokenStream<ComponentValue>&, PositionParsingMode = PositionParsingMode::Normal);
     RefPtr<StyleValue const> parse_filter_value_list_value(TokenStream<ComponentValue>&);
     RefPtr<StyleValue const> parse_contain_value(TokenStream<ComponentValue>&);
+    RefPtr<StyleValue const> parse_contain_intrinsic_size_value(PropertyID, TokenStream<ComponentValue>&);
+    RefPtr<StyleValue const> parse_contain_intrinsic_size_shorthand_value(TokenStream<ComponentValue>&);
     RefPtr<StringStyleValue const> parse_opentype_tag_value(TokenStream<ComponentValue>&);
     RefPtr<FontSourceStyleValue const> parse_font_source_value(TokenStream<ComponentValue>&);
 
@@ -520,6 +520,15 @@ Parser::ParseErrorOr<NonnullRefPtr<StyleValue const>> Parser::parse_css_value(Pr
         if (auto parsed_value = parse_columns_value(tokens); parsed_value && !tokens.has_next_token())
             return parsed_value.release_nonnull();
         return ParseError::SyntaxError;
+    case PropertyID::ContainIntrinsicHeight:
+    case PropertyID::ContainIntrinsicWidth:
+        if (auto parsed_value = parse_contain_intrinsic_size_value(property_id, tokens); parsed_value && !tokens.has_next_token())
+            return parsed_value.release_nonnull();
+        return ParseError::SyntaxError;
+    case PropertyID::ContainIntrinsicSize:
+        if (auto parsed_value = parse_contain_intrinsic_size_shorthand_value(tokens); parsed_value && !tokens.has_next_token())
+            return parsed_value.release_nonnull();
+        return ParseError::SyntaxError;
     case PropertyID::Content:
         if (auto parsed_value = parse_content_value(tokens); parsed_value && !tokens.has_next_token())
             return parsed_value.release_nonnull();
@@ -5550,6 +5559,51 @@ RefPtr<StyleValue const> Parser::parse_contain_value(TokenStream<ComponentValue>
     return StyleValueList::create(move(containment_values), StyleValueList::Separator::Space);
 }
 
+// https://drafts.csswg.org/css-sizing-4/#intrinsic-size-override
+RefPtr<StyleValue const> Parser::parse_contain_intrinsic_size_value(PropertyID property_id, TokenStream<ComponentValue>& tokens)
+{
+    // auto? [ none | <length [0,∞]> ]
+    auto transaction = tokens.begin_transaction();
+    auto maybe_value = parse_css_value_for_property(property_id, tokens);
+    if (!maybe_value)
+        return nullptr;
+
+    if (maybe_value->to_keyword() != Keyword::Auto) {
+        transaction.commit();
+        return maybe_value;
+    }
+
+    auto maybe_size_value = parse_css_value_for_property(property_id, tokens);
+    if (!maybe_size_value || maybe_size_value->to_keyword() == Keyword::Auto)
+        return nullptr;
+
+    transaction.commit();
+    return StyleValueList::create(
+        StyleValueVector { maybe_value.release_nonnull(), maybe_size_value.release_nonnull() },
+        StyleValueList::Separator::Space);
+}
+
+RefPtr<StyleValue const> Parser::parse_contain_intrinsic_size_shorthand_value(TokenStream<ComponentValue>& tokens)
+{
+    // [ auto? [ none | <length [0,∞]> ] ]{1,2}
+    auto transaction = tokens.begin_transaction();
+    auto width_value = parse_contain_intrinsic_size_value(PropertyID::ContainIntrinsicWidth, tokens);
+    if (!width_value)
+        return nullptr;
+
+    RefPtr<StyleValue const> height_value = width_value;
+    if (tokens.has_next_token()) {
+        height_value = parse_contain_intrinsic_size_value(PropertyID::ContainIntrinsicHeight, tokens);
+        if (!height_value)
+            return nullptr;
+    }
+
+    transaction.commit();
+    return ShorthandStyleValue::create(PropertyID::ContainIntrinsicSize,
+        { PropertyID::ContainIntrinsicWidth, PropertyID::ContainIntrinsicHeight },
+        { width_value.release_nonnull(), height_value.release_nonnull() });
+}
+
 // https://www.w3.org/TR/css-text-4/#white-space-trim
 RefPtr<StyleValue const> Parser::parse_white_space_trim_value(TokenStream<ComponentValue>& tokens)
 {
@@ -132,7 +132,58 @@ Selector::Selector(Vector<CompoundSelector>&& compound_selectors)
 
     collect_ancestor_hashes();
 
-    m_can_use_fast_matches = can_selector_use_fast_matches(*this);
+    if (can_selector_use_fast_matches(*this))
+        compile_fast_match_program();
+}
+
+void Selector::compile_fast_match_program()
+{
+    auto program = make<FastMatchProgram>();
+    program->compounds.ensure_capacity(m_compound_selectors.size());
+
+    for (auto const& compound_selector : m_compound_selectors) {
+        FastMatchProgram::Compound compound {
+            .combinator = compound_selector.combinator,
+            .first_instruction = static_cast<u32>(program->instructions.size()),
+            .instruction_count = 0,
+            .can_match_shadow_host = compound_selector.simple_selectors.is_empty(),
+        };
+
+        auto emit = [&](FastMatchProgram::Instruction instruction) {
+            program->instructions.append(move(instruction));
+            ++compound.instruction_count;
+        };
+
+        for (auto const& simple_selector : compound_selector.simple_selectors) {
+            switch (simple_selector.type) {
+            case SimpleSelector::Type::TagName:
+                emit({ .operation = FastMatchProgram::Operation::TagName, .name = simple_selector.qualified_name().name.name, .lowercase_name = simple_selector.qualified_name().name.lowercase_name });
+                [[fallthrough]];
+            case SimpleSelector::Type::Universal:
+                if (simple_selector.qualified_name().namespace_type != SimpleSelector::QualifiedName::NamespaceType::Any)
+                    emit({ .operation = FastMatchProgram::Operation::Namespace, .simple_selector = &simple_selector });
+                break;
+            case SimpleSelector::Type::Class:
+                emit({ .operation = FastMatchProgram::Operation::Class, .name = simple_selector.name() });
+                break;
+            case SimpleSelector::Type::Id:
+                emit({ .operation = FastMatchProgram::Operation::Id, .name = simple_selector.name() });
+                break;
+            case SimpleSelector::Type::Attribute:
+                emit({ .operation = FastMatchProgram::Operation::Attribute, .simple_selector = &simple_selector });
+                break;
+            case SimpleSelector::Type::PseudoClass:
+                emit({ .operation = FastMatchProgram::Operation::PseudoClass, .simple_selector = &simple_selector });
+                break;
+            default:
+                VERIFY_NOT_REACHED();
+            }
+        }
+
+        program->compounds.unchecked_append(compound);
+    }
+
+    m_fast_match_program = move(program);
 }
 
 void Selector::collect_ancestor_hashes()
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AK/FlyString.h>
+#include <AK/OwnPtr.h>
 #include <AK/RefCounted.h>
 #include <AK/String.h>
 #include <AK/Vector.h>
@@ -201,6 +202,42 @@ public:
         Optional<CompoundSelector> absolutized(SimpleSelector const& selector_for_nesting) const;
     };
 
+    // A flattened form of the selectors that only use descendant/child combinators and the simple selectors common in
+    // real-world style sheets, which SelectorEngine matches in a single loop. Names are resolved up front, and simple
+    // selectors that match any element (like a plain `*`) are left out entirely.
+    struct FastMatchProgram {
+        enum class Operation : u8 {
+            TagName,
+            Namespace,
+            Class,
+            Id,
+            Attribute,
+            PseudoClass,
+        };
+
+        struct Instruction {
+            Operation operation;
+            // The name for TagName, Class and Id.
+            FlyString name;
+            // For TagName, the name that HTML elements in HTML documents are compared against.
+            FlyString lowercase_name;
+            // For Namespace, Attribute and PseudoClass, the simple selector to match.
+            SimpleSelector const* simple_selector { nullptr };
+        };
+
+        // One for each compound selector, in the same order.
+        struct Compound {
+            Combinator combinator { Combinator::None };
+            u32 first_instruction { 0 };
+            u32 instruction_count { 0 };
+            // Only :host may match the shadow host from within its shadow tree, so any simple selector blocks it.
+            bool can_match_shadow_host { false };
+        };
+
+        Vector<Instruction> instructions;
+        Vector<Compound> compounds;
+    };
+
     static NonnullRefPtr<Selector> create(Vector<CompoundSelector>&& compound_selectors)
     {
         return adopt_ref(*new Selector(move(compound_selectors)));
@@ -220,7 +257,8 @@ public:
 
     auto const& ancestor_hashes() const { return m_ancestor_hashes; }
 
-    bool can_use_fast_matches() const { return m_can_use_fast_matches; }
+    bool can_use_fast_matches() const { return m_fast_match_program.ptr() != nullptr; }
+    FastMatchProgram const& fast_match_program() const { return *m_fast_match_program; }
     bool can_use_ancestor_filter() const { return m_can_use_ancestor_filter; }
 
     size_t sibling_invalidation_distance() const;
@@ -232,15 +270,16 @@ private:
     mutable Optional<u32> m_specificity;
     Optional<Selector::PseudoElementSelector> m_pseudo_element;
     mutable Optional<size_t> m_sibling_invalidation_distance;
-    bool m_can_use_fast_matches { false };
     bool m_can_use_ancestor_filter { false };
     bool m_contains_the_nesting_selector { false };
 
     PseudoClassBitmap m_contained_pseudo_classes;
 
     void collect_ancestor_hashes();
+    void compile_fast_match_program();
 
     Array<u32, 8> m_ancestor_hashes;
+    OwnPtr<FastMatchProgram> m_fast_match_program;
 };
 
 String serialize_a_group_of_selectors(SelectorList const& selectors);
@@ -211,7 +211,22 @@ static inline bool matches_relative_selector(CSS::Selector const& selector, size
 // https://drafts.csswg.org/selectors-4/#relational
 static inline bool matches_has_pseudo_class(CSS::Selector const& selector, DOM::Element const& anchor, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
 {
-    return matches_relative_selector(selector, 0, anchor, shadow_host, context, anchor);
+    if (!context.has_result_cache)
+        return matches_relative_selector(selector, 0, anchor, shadow_host, context, anchor);
+
+    // The same anchor tends to be matched against the same :has() many times during a style update, e.g. once for each
+    // of its descendants with ".a:has(.b) .c", and each time may traverse its whole subtree.
+    HasResultCacheKey key { &selector, &anchor, shadow_host.ptr() };
+    if (auto cached_result = context.has_result_cache->get(key); cached_result.has_value()) {
+        context.attempted_pseudo_class_matches |= cached_result->attempted_pseudo_class_matches;
+        return cached_result->matches;
+    }
+
+    auto attempted_pseudo_class_matches = exchange(context.attempted_pseudo_class_matches, {});
+    bool result = matches_relative_selector(selector, 0, anchor, shadow_host, context, anchor);
+    context.has_result_cache->set(key, { result, context.attempted_pseudo_class_matches });
+    context.attempted_pseudo_class_matches |= attempted_pseudo_class_matches;
+    return result;
 }
 
 static bool matches_hover_pseudo_class(DOM::Element const& element)
@@ -1234,60 +1249,67 @@ bool matches(CSS::Selector const& selector, DOM::Element const& element, GC::Ptr
     return matches(selector, selector.compound_selectors().size() - 1, element, shadow_host, context, scope, selector_kind, anchor);
 }
 
-static bool fast_matches_simple_selector(CSS::Selector::SimpleSelector const& simple_selector, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
+static bool fast_matches_compound_selector(CSS::Selector::FastMatchProgram const& program, size_t compound_index, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
 {
-    if (should_block_shadow_host_matching(simple_selector, shadow_host, element))
+    using Operation = CSS::Selector::FastMatchProgram::Operation;
+
+    auto const& compound = program.compounds[compound_index];
+    if (shadow_host && &element == shadow_host.ptr() && !compound.can_match_shadow_host)
         return false;
 
-    switch (simple_selector.type) {
-    case CSS::Selector::SimpleSelector::Type::Universal:
-        return matches_namespace(simple_selector.qualified_name(), element, context.style_sheet_for_rule);
-    case CSS::Selector::SimpleSelector::Type::TagName:
-        // https://html.spec.whatwg.org/multipage/semantics-other.html#case-sensitivity-of-selectors
-        // When comparing a CSS element type selector to the names of HTML elements in HTML documents, the CSS element type selector must first be converted to ASCII lowercase. The
-        // same selector when compared to other elements must be compared according to its original case. In both cases, to match the values must be identical to each other (and therefore
-        // the comparison is case sensitive).
-        if (element.namespace_uri() == Namespace::HTML && element.document().document_type() == DOM::Document::Type::HTML) {
-            if (simple_selector.qualified_name().name.lowercase_name != element.local_name())
+    for (size_t i = 0; i < compound.instruction_count; ++i) {
+        auto const& instruction = program.instructions[compound.first_instruction + i];
+        switch (instruction.operation) {
+        case Operation::TagName:
+            // https://html.spec.whatwg.org/multipage/semantics-other.html#case-sensitivity-of-selectors
+            // When comparing a CSS element type selector to the names of HTML elements in HTML documents, the CSS element type selector must first be converted to ASCII lowercase. The
+            // same selector when compared to other elements must be compared according to its original case. In both cases, to match the values must be identical to each other (and therefore
+            // the comparison is case sensitive).
+            if (element.namespace_uri() == Namespace::HTML && element.document().document_type() == DOM::Document::Type::HTML) {
+                if (instruction.lowercase_name != element.local_name())
+                    return false;
+            } else if (instruction.name != element.local_name()) {
+                // NOTE: Any other elements are either SVG, XHTML or MathML, all of which are case-sensitive.
                 return false;
-        } else if (simple_selector.qualified_name().name.name != element.local_name()) {
-            // NOTE: Any other elements are either SVG, XHTML or MathML, all of which are case-sensitive.
-            return false;
+            }
+            break;
+        case Operation::Namespace:
+            if (!matches_namespace(instruction.simple_selector->qualified_name(), element, context.style_sheet_for_rule))
+                return false;
+            break;
+        case Operation::Class: {
+            // Class selectors are matched case insensitively in quirks mode.
+            // See: https://drafts.csswg.org/selectors-4/#class-html
+            auto case_sensitivity = element.document().in_quirks_mode() ? CaseSensitivity::CaseInsensitive : CaseSensitivity::CaseSensitive;
+            if (!element.has_class(instruction.name, case_sensitivity))
+                return false;
+            break;
+        }
+        case Operation::Id:
+            if (instruction.name != element.id())
+                return false;
+            break;
+        case Operation::Attribute:
+            if (!matches_attribute(instruction.simple_selector->attribute(), context.style_sheet_for_rule, element))
+                return false;
+            break;
+        case Operation::PseudoClass:
+            if (!matches_pseudo_class(instruction.simple_selector->pseudo_class(), element, shadow_host, context, nullptr, SelectorKind::Normal))
+                return false;
+            break;
         }
-        return matches_namespace(simple_selector.qualified_name(), element, context.style_sheet_for_rule);
-    case CSS::Selector::SimpleSelector::Type::Class: {
-        // Class selectors are matched case insensitively in quirks mode.
-        // See: https://drafts.csswg.org/selectors-4/#class-html
-        auto case_sensitivity = element.document().in_quirks_mode() ? CaseSensitivity::CaseInsensitive : CaseSensitivity::CaseSensitive;
-        return element.has_class(simple_selector.name(), case_sensitivity);
-    }
-    case CSS::Selector::SimpleSelector::Type::Id:
-        return simple_selector.name() == element.id();
-    case CSS::Selector::SimpleSelector::Type::Attribute:
-        return matches_attribute(simple_selector.attribute(), context.style_sheet_for_rule, element);
-    case CSS::Selector::SimpleSelector::Type::PseudoClass:
-        return matches_pseudo_class(simple_selector.pseudo_class(), element, shadow_host, context, nullptr, SelectorKind::Normal);
-    default:
-        VERIFY_NOT_REACHED();
-    }
-}
-
-static bool fast_matches_compound_selector(CSS::Selector::CompoundSelector const& compound_selector, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
-{
-    for (auto const& simple_selector : compound_selector.simple_selectors) {
-        if (!fast_matches_simple_selector(simple_selector, element, shadow_host, context))
-            return false;
     }
     return true;
 }
 
 bool fast_matches(CSS::Selector const& selector, DOM::Element const& element_to_match, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
 {
+    auto const& program = selector.fast_match_program();
     DOM::Element const* current = &element_to_match;
 
     ssize_t compound_selector_index = selector.compound_selectors().size() - 1;
 
-    if (!fast_matches_compound_selector(selector.compound_selectors().last(), *current, shadow_host, context))
+    if (!fast_matches_compound_selector(program, compound_selector_index, *current, shadow_host, context))
         return false;
 
     // NOTE: If we fail after following a child combinator, we may need to backtrack
@@ -1301,27 +1323,25 @@ bool fast_matches(CSS::Selector const& selector, DOM::Element const& element_to_
         // NOTE: There should always be a leftmost compound selector without combinator that kicks us out of this loop.
         VERIFY(compound_selector_index >= 0);
 
-        auto const* compound_selector = &selector.compound_selectors()[compound_selector_index];
-
-        switch (compound_selector->combinator) {
+        switch (program.compounds[compound_selector_index].combinator) {
         case CSS::Selector::Combinator::None:
             return true;
         case CSS::Selector::Combinator::Descendant:
             backtrack_state = { current->parent_element(), compound_selector_index };
-            compound_selector = &selector.compound_selectors()[--compound_selector_index];
+            --compound_selector_index;
             for (current = current->parent_element(); current; current = current->parent_element()) {
-                if (fast_matches_compound_selector(*compound_selector, *current, shadow_host, context))
+                if (fast_matches_compound_selector(program, compound_selector_index, *current, shadow_host, context))
                     break;
             }
             if (!current)
                 return false;
             break;
         case CSS::Selector::Combinator::ImmediateChild:
-            compound_selector = &selector.compound_selectors()[--compound_selector_index];
+            --compound_selector_index;
             current = current->parent_element();
             if (!current)
                 return false;
-            if (!fast_matches_compound_selector(*compound_selector, *current, shadow_host, context)) {
+            if (!fast_matches_compound_selector(program, compound_selector_index, *current, shadow_host, context)) {
                 if (backtrack_state.element) {
                     current = backtrack_state.element;
                     compound_selector_index = backtrack_state.compound_selector_index;
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <LibWeb/CSS/Selector.h>
 #include <LibWeb/DOM/Element.h>
 
@@ -16,13 +17,43 @@ enum class SelectorKind {
     Relative,
 };
 
+struct HasResultCacheKey {
+    CSS::Selector const* relative_selector { nullptr };
+    DOM::Element const* anchor { nullptr };
+    DOM::Element const* shadow_host { nullptr };
+
+    bool operator==(HasResultCacheKey const&) const = default;
+};
+
+struct HasResult {
+    bool matches { false };
+    CSS::PseudoClassBitmap attempted_pseudo_class_matches {};
+};
+
+// Results of matching :has() arguments against their anchors. These are only valid as long as neither the DOM nor
+// the state of any element changes, so a cache should not outlive a single style update.
+using HasResultCache = HashMap<HasResultCacheKey, HasResult>;
+
 struct MatchContext {
     GC::Ptr<CSS::CSSStyleSheet const> style_sheet_for_rule {};
     GC::Ptr<DOM::Element const> subject {};
     bool collect_per_element_selector_involvement_metadata { false };
     CSS::PseudoClassBitmap attempted_pseudo_class_matches {};
+    HasResultCache* has_result_cache { nullptr };
 };
 
 bool matches(CSS::Selector const&, DOM::Element const&, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context, Optional<CSS::PseudoElement> = {}, GC::Ptr<DOM::ParentNode const> scope = {}, SelectorKind selector_kind = SelectorKind::Normal, GC::Ptr<DOM::Element const> anchor = nullptr);
 
 }
+
+namespace AK {
+
+template<>
+struct Traits<Web::SelectorEngine::HasResultCacheKey> : DefaultTraits<Web::SelectorEngine::HasResultCacheKey> {
+    static unsigned hash(Web::SelectorEngine::HasResultCacheKey const& key)
+    {
+        return pair_int_hash(pair_int_hash(ptr_hash(key.relative_selector), ptr_hash(key.anchor)), ptr_hash(key.shadow_host));
+    }
+};
+
+}
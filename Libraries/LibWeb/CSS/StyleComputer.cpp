@@ -26,6 +26,7 @@
 #include <LibWeb/Animations/AnimationEffect.h>
 #include <LibWeb/Animations/DocumentTimeline.h>
 #include <LibWeb/Bindings/PrincipalHostDefined.h>
+#include <LibWeb/CSS/AncestorFilter.h>
 #include <LibWeb/CSS/AnimationEvent.h>
 #include <LibWeb/CSS/CSSAnimation.h>
 #include <LibWeb/CSS/CSSFontFaceRule.h>
@@ -186,7 +187,6 @@ StyleComputer::StyleComputer(DOM::Document& document)
     , m_default_font_metrics(16, Platform::FontPlugin::the().default_font(16)->pixel_metrics())
     , m_root_element_font_metrics(m_default_font_metrics)
 {
-    m_ancestor_filter = make<CountingBloomFilter<u8, 14>>();
     m_qualified_layer_names_in_order.append({});
 }
 
@@ -198,6 +198,12 @@ void StyleComputer::visit_edges(Visitor& visitor)
     visitor.visit(m_document);
     visitor.visit(m_loaded_fonts);
     visitor.visit(m_user_style_sheet);
+    for (auto& candidate : m_style_sharing_candidates) {
+        visitor.visit(candidate.element);
+        visitor.visit(candidate.style);
+        visitor.visit(candidate.parent);
+        visitor.visit(candidate.parent_style);
+    }
 }
 
 FontLoader::FontLoader(StyleComputer& style_computer, GC::Ptr<CSSStyleSheet> parent_style_sheet, FlyString family_name, Vector<Gfx::UnicodeRange> unicode_ranges, Vector<URL> urls, Function<void(RefPtr<Gfx::Typeface const>)> on_load)
@@ -538,8 +544,8 @@ Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::Element c
         if (!rule_is_relevant_for_current_scope)
             return;
 
-        auto const& selector = rule_to_run.selector;
-        if (selector.can_use_ancestor_filter() && should_reject_with_ancestor_filter(selector))
+        auto const& selector = *rule_to_run.selector;
+        if (selector.can_use_ancestor_filter() && m_ancestor_filter && m_ancestor_filter->should_reject(selector))
             return;
 
         rules_to_run.unchecked_append(rule_to_run);
@@ -592,12 +598,13 @@ Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::Element c
         if (element.is_shadow_host() && rule_root != element.shadow_root())
             shadow_host_to_use = nullptr;
 
-        auto const& selector = rule_to_run.selector;
+        auto const& selector = *rule_to_run.selector;
 
         SelectorEngine::MatchContext context {
             .style_sheet_for_rule = *rule_to_run.sheet,
             .subject = element,
             .collect_per_element_selector_involvement_metadata = true,
+            .has_result_cache = m_has_result_cache.has_value() ? &m_has_result_cache.value() : nullptr,
         };
         ScopeGuard guard = [&] {
             attempted_pseudo_class_matches |= context.attempted_pseudo_class_matches;
@@ -613,8 +620,8 @@ Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::Element c
 static void sort_matching_rules(Vector<MatchingRule const*>& matching_rules)
 {
     quick_sort(matching_rules, [&](MatchingRule const* a, MatchingRule const* b) {
-        auto const& a_selector = a->selector;
-        auto const& b_selector = b->selector;
+        auto const& a_selector = *a->selector;
+        auto const& b_selector = *b->selector;
         auto a_specificity = a_selector.specificity();
         auto b_specificity = b_selector.specificity();
         if (a_specificity == b_specificity) {
@@ -2144,14 +2151,15 @@ void StyleComputer::absolutize_values(ComputedProperties& style, GC::Ptr<DOM::El
     };
 
     // "A percentage value specifies an absolute font size relative to the parent element’s computed font-size. Negative percentages are invalid."
-    auto& font_size_value_slot = style.m_property_values[to_underlying(CSS::PropertyID::FontSize)];
-    if (font_size_value_slot && font_size_value_slot->is_percentage()) {
+    RefPtr font_size_value = style.value_slot(CSS::PropertyID::FontSize);
+    if (font_size_value && font_size_value->is_percentage()) {
         auto parent_font_size = get_inherit_value(CSS::PropertyID::FontSize, element)->as_length().length().to_px(viewport_rect(), font_metrics, m_root_element_font_metrics);
-        font_size_value_slot = LengthStyleValue::create(
-            Length::make_px(CSSPixels::nearest_value_for(parent_font_size * font_size_value_slot->as_percentage().percentage().as_fraction())));
+        font_size_value = LengthStyleValue::create(
+            Length::make_px(CSSPixels::nearest_value_for(parent_font_size * font_size_value->as_percentage().percentage().as_fraction())));
+        style.set_value_slot(CSS::PropertyID::FontSize, font_size_value);
     }
 
-    auto font_size = font_size_value_slot->as_length().length().to_px(viewport_rect(), font_metrics, m_root_element_font_metrics);
+    auto font_size = font_size_value->as_length().length().to_px(viewport_rect(), font_metrics, m_root_element_font_metrics);
     font_metrics.font_size = font_size;
     style.set_font_size({}, font_size);
 
@@ -2159,24 +2167,31 @@ void StyleComputer::absolutize_values(ComputedProperties& style, GC::Ptr<DOM::El
     //       We have to resolve them right away, so that the *computed* line-height is ready for inheritance.
     //       We can't simply absolutize *all* percentage values against the font size,
     //       because most percentages are relative to containing block metrics.
-    auto& line_height_value_slot = style.m_property_values[to_underlying(CSS::PropertyID::LineHeight)];
-    if (line_height_value_slot && line_height_value_slot->is_percentage()) {
-        line_height_value_slot = LengthStyleValue::create(
-            Length::make_px(CSSPixels::nearest_value_for(font_size * static_cast<double>(line_height_value_slot->as_percentage().percentage().as_fraction()))));
+    RefPtr line_height_value = style.value_slot(CSS::PropertyID::LineHeight);
+    if (line_height_value && line_height_value->is_percentage()) {
+        line_height_value = LengthStyleValue::create(
+            Length::make_px(CSSPixels::nearest_value_for(font_size * static_cast<double>(line_height_value->as_percentage().percentage().as_fraction()))));
+        style.set_value_slot(CSS::PropertyID::LineHeight, line_height_value);
     }
 
     auto line_height = style.compute_line_height(viewport_rect(), font_metrics, m_root_element_font_metrics);
     font_metrics.line_height = line_height;
 
     // NOTE: line-height might be using lh which should be resolved against the parent line height (like we did here already)
-    if (line_height_value_slot && line_height_value_slot->is_length())
-        line_height_value_slot = LengthStyleValue::create(Length::make_px(line_height));
+    //       An inherited value that is already in px is kept as-is, so that the value (and its group) stays shared with the parent.
+    if (line_height_value && line_height_value->is_length() && line_height_value->as_length().length() != Length::make_px(line_height))
+        style.set_value_slot(CSS::PropertyID::LineHeight, LengthStyleValue::create(Length::make_px(line_height)));
 
-    for (size_t i = 0; i < style.m_property_values.size(); ++i) {
-        auto& value_slot = style.m_property_values[i];
-        if (!value_slot)
+    // NOTE: Values that are already absolute come back unchanged, so only write the ones that actually changed, to avoid
+    //       unsharing their groups.
+    for (size_t i = 0; i < ComputedProperties::number_of_properties; ++i) {
+        auto property_id = static_cast<CSS::PropertyID>(i);
+        auto const* value = style.value_slot(property_id);
+        if (!value)
             continue;
-        value_slot = value_slot->absolutized(viewport_rect(), font_metrics, m_root_element_font_metrics);
+        auto absolutized_value = value->absolutized(viewport_rect(), font_metrics, m_root_element_font_metrics);
+        if (absolutized_value.ptr() != value)
+            style.set_value_slot(property_id, absolutized_value);
     }
 
     style.set_line_height({}, line_height);
@@ -2432,6 +2447,12 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::Element& elem
 
     ScopeGuard guard { [&element]() { element.set_needs_style_update(false); } };
 
+    bool const element_may_share_style = !pseudo_element.has_value() && mode == ComputeStyleMode::Normal && may_share_style(element);
+    if (element_may_share_style) {
+        if (auto style = share_style_with_sibling(element, did_change_custom_properties))
+            return style;
+    }
+
     // 1. Perform the cascade. This produces the "specified style"
     bool did_match_any_pseudo_element_rules = false;
     PseudoClassBitmap attempted_pseudo_class_matches;
@@ -2490,9 +2511,122 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::Element& elem
         *did_change_custom_properties = true;
     }
 
+    if (element_may_share_style)
+        remember_shareable_style(element, computed_properties);
+
     return computed_properties;
 }
 
+// Style sharing: siblings that have the same tag and attributes, inherit from the same parent style, and that no
+// sibling-dependent or state-dependent selector has looked at, are guaranteed to get the same cascade. So instead
+// of matching rules and cascading again, such an element copies the style of a sibling computed earlier in the same
+// style update. This is what makes large tables and lists with thousands of identical rows cheap to style.
+bool StyleComputer::may_share_style(DOM::Element const& element) const
+{
+    if (!element.can_share_computed_style_with_siblings())
+        return false;
+    if (!element.element_to_inherit_style_from({}))
+        return false;
+    if (element.inline_style() || element.is_shadow_host() || element.assigned_slot_internal())
+        return false;
+    // Animations and transitions write into the computed style of their target, so it can't be a copy of another element's.
+    if (element.has_associated_animations() || element.cached_animation_name_source({}) || element.cached_transition_property_source({}))
+        return false;
+    // :has() makes an element's style depend on its descendants, which siblings don't have in common.
+    if (may_have_has_selectors())
+        return false;
+    return true;
+}
+
+static bool have_same_attributes(DOM::Element const& a, DOM::Element const& b)
+{
+    if (a.attribute_list_size() != b.attribute_list_size())
+        return false;
+    bool same = true;
+    a.for_each_attribute([&](DOM::Attr const& attribute) {
+        if (same && b.get_attribute_ns(attribute.namespace_uri(), attribute.local_name()) != attribute.value())
+            same = false;
+    });
+    return same;
+}
+
+GC::Ptr<ComputedProperties> StyleComputer::share_style_with_sibling(DOM::Element& element, Optional<bool&> did_change_custom_properties) const
+{
+    auto parent = element.element_to_inherit_style_from({});
+    auto parent_style = const_cast<DOM::Element&>(*parent).computed_properties();
+    if (!parent_style)
+        return {};
+
+    for (auto const& candidate : m_style_sharing_candidates) {
+        if (candidate.parent.ptr() != parent.ptr() || candidate.parent_style.ptr() != parent_style.ptr())
+            continue;
+        if (candidate.element.ptr() == &element || candidate.element->computed_properties().ptr() != candidate.style.ptr())
+            continue;
+        if (candidate.element->local_name() != element.local_name() || candidate.element->namespace_uri() != element.namespace_uri())
+            continue;
+        if (!have_same_attributes(candidate.element, element))
+            continue;
+        // Top layer and directionality are not reflected in the attributes, but selectors can depend on them.
+        if (candidate.element->in_top_layer() != element.in_top_layer() || candidate.element->rendered_in_top_layer() != element.rendered_in_top_layer())
+            continue;
+        if (candidate.element->directionality() != element.directionality())
+            continue;
+
+        DOM::AbstractElement abstract_element { element };
+        auto old_custom_properties = abstract_element.custom_properties();
+        element.set_custom_properties({}, candidate.element->custom_properties({}));
+        element.set_cascaded_properties({}, candidate.element->cascaded_properties({}));
+        if (candidate.element->style_uses_var_css_function())
+            element.set_style_uses_var_css_function();
+
+        if (did_change_custom_properties.has_value() && abstract_element.custom_properties() != old_custom_properties)
+            *did_change_custom_properties = true;
+
+        // The computed style of an element gets updated in place (e.g. when inherited values change), so each element
+        // needs its own ComputedProperties. The style values themselves are shared.
+        return candidate.style->clone();
+    }
+    return {};
+}
+
+void StyleComputer::remember_shareable_style(DOM::Element& element, ComputedProperties& style) const
+{
+    // If any selector looked at this element's siblings or its pseudo-class state, the result may not hold for its siblings.
+    if (style.has_attempted_any_pseudo_class_match() || element.style_affected_by_structural_changes())
+        return;
+    // Selector matching flags elements whose style has to be invalidated when something other than their own
+    // attributes change. A copy of the style wouldn't carry those flags, and so wouldn't get invalidated.
+    if (element.sibling_invalidation_distance() != 0 || element.style_uses_attr_css_function())
+        return;
+    if (element.affected_by_has_pseudo_class_in_subject_position() || element.affected_by_has_pseudo_class_in_non_subject_position()
+        || element.affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator())
+        return;
+    if (style.animation_name_source() || style.transition_property_source())
+        return;
+
+    auto parent = element.element_to_inherit_style_from({});
+    auto parent_style = const_cast<DOM::Element&>(*parent).computed_properties();
+    if (!parent_style)
+        return;
+
+    if (m_style_sharing_candidates.size() == style_sharing_cache_size)
+        m_style_sharing_candidates.take_first();
+    m_style_sharing_candidates.append({ element, style, *parent, *parent_style });
+}
+
+void StyleComputer::reset_style_sharing_cache()
+{
+    m_style_sharing_candidates.clear_with_capacity();
+}
+
+void StyleComputer::set_caching_has_results(bool enabled)
+{
+    if (enabled)
+        m_has_result_cache.emplace();
+    else
+        m_has_result_cache.clear();
+}
+
 static bool is_monospace(StyleValue const& value)
 {
     if (value.to_keyword() == Keyword::Monospace)
@@ -2727,6 +2861,10 @@ GC::Ref<ComputedProperties> StyleComputer::compute_properties(DOM::Element& elem
         start_needed_transitions(*previous_style, computed_style, element, pseudo_element);
     }
 
+    // 9. Share storage with the parent and other elements that ended up with the same values
+    auto const* parent_element = element.element_to_inherit_style_from(pseudo_element);
+    computed_style->share_property_groups({}, parent_element ? parent_element->computed_properties().ptr() : nullptr, m_property_value_group_cache);
+
     return computed_style;
 }
 
@@ -2789,6 +2927,72 @@ void StyleComputer::collect_selector_insights(Selector const& selector, Selector
     }
 }
 
+void StyleComputer::add_rule_to_rule_caches(RuleCaches& rule_caches, CSSRule const& rule, CSSStyleSheet const& sheet, GC::Ptr<DOM::ShadowRoot const> shadow_root, CascadeOrigin cascade_origin, size_t style_sheet_index, size_t rule_index, SelectorInsights& insights)
+{
+    SelectorList const& absolutized_selectors = [&]() {
+        if (rule.type() == CSSRule::Type::Style)
+            return static_cast<CSSStyleRule const&>(rule).absolutized_selectors();
+        if (rule.type() == CSSRule::Type::NestedDeclarations)
+            return static_cast<CSSNestedDeclarations const&>(rule).parent_style_rule().absolutized_selectors();
+        VERIFY_NOT_REACHED();
+    }();
+
+    for (auto const& selector : absolutized_selectors) {
+        m_style_invalidation_data->build_invalidation_sets_for_selector(selector);
+    }
+
+    for (CSS::Selector const& selector : absolutized_selectors) {
+        MatchingRule matching_rule {
+            shadow_root,
+            &rule,
+            sheet,
+            sheet.default_namespace(),
+            selector,
+            style_sheet_index,
+            rule_index,
+            selector.specificity(),
+            cascade_origin,
+            false,
+        };
+
+        auto const& qualified_layer_name = matching_rule.qualified_layer_name();
+        auto& rule_cache = qualified_layer_name.is_empty() ? rule_caches.main : *rule_caches.by_layer.ensure(qualified_layer_name, [] { return make<RuleCache>(); });
+
+        bool contains_root_pseudo_class = false;
+        Optional<CSS::PseudoElement> pseudo_element;
+
+        collect_selector_insights(selector, insights);
+
+        for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
+            if (!matching_rule.contains_pseudo_element) {
+                if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoElement) {
+                    matching_rule.contains_pseudo_element = true;
+                    pseudo_element = simple_selector.pseudo_element().type();
+                }
+            }
+            if (!contains_root_pseudo_class) {
+                if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass
+                    && simple_selector.pseudo_class().type == CSS::PseudoClass::Root) {
+                    contains_root_pseudo_class = true;
+                }
+            }
+        }
+
+        for (size_t i = 0; i < to_underlying(PseudoClass::__Count); ++i) {
+            auto pseudo_class = static_cast<PseudoClass>(i);
+            // If we're not building a rule cache for this pseudo class, just ignore it.
+            if (!m_pseudo_class_rule_cache[i])
+                continue;
+            if (selector.contains_pseudo_class(pseudo_class)) {
+                // For pseudo class rule caches we intentionally pass no pseudo-element, because we don't want to bucket pseudo class rules by pseudo-element type.
+                m_pseudo_class_rule_cache[i]->add_rule(matching_rule, {}, contains_root_pseudo_class);
+            }
+        }
+
+        rule_cache.add_rule(matching_rule, pseudo_element, contains_root_pseudo_class);
+    }
+}
+
 void StyleComputer::make_rule_cache_for_cascade_origin(CascadeOrigin cascade_origin, SelectorInsights& insights)
 {
     Vector<MatchingRule> matching_rules;
@@ -2816,71 +3020,13 @@ void StyleComputer::make_rule_cache_for_cascade_origin(CascadeOrigin cascade_ori
 
         size_t rule_index = 0;
         sheet.for_each_effective_style_producing_rule([&](auto const& rule) {
-            SelectorList const& absolutized_selectors = [&]() {
-                if (rule.type() == CSSRule::Type::Style)
-                    return static_cast<CSSStyleRule const&>(rule).absolutized_selectors();
-                if (rule.type() == CSSRule::Type::NestedDeclarations)
-                    return static_cast<CSSNestedDeclarations const&>(rule).parent_style_rule().absolutized_selectors();
-                VERIFY_NOT_REACHED();
-            }();
-
-            for (auto const& selector : absolutized_selectors) {
-                m_style_invalidation_data->build_invalidation_sets_for_selector(selector);
-            }
-
-            for (CSS::Selector const& selector : absolutized_selectors) {
-                MatchingRule matching_rule {
-                    shadow_root,
-                    &rule,
-                    sheet,
-                    sheet.default_namespace(),
-                    selector,
-                    style_sheet_index,
-                    rule_index,
-                    selector.specificity(),
-                    cascade_origin,
-                    false,
-                };
-
-                auto const& qualified_layer_name = matching_rule.qualified_layer_name();
-                auto& rule_cache = qualified_layer_name.is_empty() ? rule_caches.main : *rule_caches.by_layer.ensure(qualified_layer_name, [] { return make<RuleCache>(); });
-
-                bool contains_root_pseudo_class = false;
-                Optional<CSS::PseudoElement> pseudo_element;
-
-                collect_selector_insights(selector, insights);
-
-                for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
-                    if (!matching_rule.contains_pseudo_element) {
-                        if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoElement) {
-                            matching_rule.contains_pseudo_element = true;
-                            pseudo_element = simple_selector.pseudo_element().type();
-                        }
-                    }
-                    if (!contains_root_pseudo_class) {
-                        if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass
-                            && simple_selector.pseudo_class().type == CSS::PseudoClass::Root) {
-                            contains_root_pseudo_class = true;
-                        }
-                    }
-                }
-
-                for (size_t i = 0; i < to_underlying(PseudoClass::__Count); ++i) {
-                    auto pseudo_class = static_cast<PseudoClass>(i);
-                    // If we're not building a rule cache for this pseudo class, just ignore it.
-                    if (!m_pseudo_class_rule_cache[i])
-                        continue;
-                    if (selector.contains_pseudo_class(pseudo_class)) {
-                        // For pseudo class rule caches we intentionally pass no pseudo-element, because we don't want to bucket pseudo class rules by pseudo-element type.
-                        m_pseudo_class_rule_cache[i]->add_rule(matching_rule, {}, contains_root_pseudo_class);
-                    }
-                }
-
-                rule_cache.add_rule(matching_rule, pseudo_element, contains_root_pseudo_class);
-            }
+            add_rule_to_rule_caches(rule_caches, rule, sheet, shadow_root, cascade_origin, style_sheet_index, rule_index, insights);
             ++rule_index;
         });
 
+        if (cascade_origin == CascadeOrigin::Author && !shadow_root && sheet.media()->matches())
+            m_author_rule_cache->document_style_sheet_positions.set(&sheet, { style_sheet_index, rule_index });
+
         // Loosely based on https://drafts.csswg.org/css-animations-2/#keyframe-processing
         sheet.for_each_effective_keyframes_at_rule([&](CSSKeyframesRule const& rule) {
             auto keyframe_set = adopt_ref(*new Animations::KeyframeEffect::KeyFrameSet);
@@ -3017,6 +3163,110 @@ void StyleComputer::build_rule_cache()
     make_rule_cache_for_cascade_origin(CascadeOrigin::UserAgent, *m_selector_insights);
 }
 
+// Elements matched by a selector must have what its rightmost compound selector requires of them, so invalidating the
+// elements that have one such id, class, tag name or attribute covers everything that a style rule could match.
+// Ids are preferred since they're likely carried by the fewest elements.
+static Optional<InvalidationSet> invalidation_set_for_elements_matched_by(CSSStyleRule const& rule, bool in_quirks_mode)
+{
+    // Nested rules would add style-producing rules of their own, and :has() can change the style of ancestors.
+    if (rule.css_rules().length() != 0)
+        return {};
+
+    InvalidationSet invalidation_set;
+    for (auto const& selector : rule.absolutized_selectors()) {
+        if (selector->contains_pseudo_class(PseudoClass::Has))
+            return {};
+
+        // Prefer whatever is likely to be carried by the fewest elements.
+        // NOTE: Ids and classes match case-insensitively in quirks mode, but invalidation sets compare them exactly.
+        //       Tag and attribute names are compared in their original case for non-HTML elements, so include both.
+        Selector::SimpleSelector const* id = nullptr;
+        Selector::SimpleSelector const* class_name = nullptr;
+        Selector::SimpleSelector const* tag_name = nullptr;
+        Selector::SimpleSelector const* attribute = nullptr;
+        for (auto const& simple_selector : selector->compound_selectors().last().simple_selectors) {
+            switch (simple_selector.type) {
+            case Selector::SimpleSelector::Type::Id:
+                if (!in_quirks_mode)
+                    id = &simple_selector;
+                break;
+            case Selector::SimpleSelector::Type::Class:
+                if (!in_quirks_mode)
+                    class_name = &simple_selector;
+                break;
+            case Selector::SimpleSelector::Type::TagName:
+                tag_name = &simple_selector;
+                break;
+            case Selector::SimpleSelector::Type::Attribute:
+                attribute = &simple_selector;
+                break;
+            default:
+                break;
+            }
+        }
+        if (id) {
+            invalidation_set.set_needs_invalidate_id(id->name());
+        } else if (class_name) {
+            invalidation_set.set_needs_invalidate_class(class_name->name());
+        } else if (tag_name) {
+            invalidation_set.set_needs_invalidate_tag_name(tag_name->qualified_name().name.name);
+            invalidation_set.set_needs_invalidate_tag_name(tag_name->qualified_name().name.lowercase_name);
+        } else if (attribute) {
+            invalidation_set.set_needs_invalidate_attribute(attribute->attribute().qualified_name.name.name);
+            invalidation_set.set_needs_invalidate_attribute(attribute->attribute().qualified_name.name.lowercase_name);
+        } else {
+            return {};
+        }
+    }
+    return invalidation_set;
+}
+
+bool StyleComputer::did_append_style_rule(CSSStyleSheet const& sheet, CSSStyleRule const& rule)
+{
+    auto invalidation_set = invalidation_set_for_elements_matched_by(rule, document().in_quirks_mode());
+    if (!invalidation_set.has_value())
+        return false;
+
+    // If the rule caches are going to be rebuilt anyway, they will pick up the new rule.
+    if (has_valid_rule_cache()) {
+        // New rules can only be given a place in the cascade order without renumbering the existing ones if they come
+        // after all the other rules of their style sheet.
+        auto position = m_author_rule_cache->document_style_sheet_positions.find(&sheet);
+        if (position == m_author_rule_cache->document_style_sheet_positions.end())
+            return false;
+        add_rule_to_rule_caches(m_author_rule_cache->for_document, rule, sheet, {}, CascadeOrigin::Author, position->value.style_sheet_index, position->value.next_rule_index++, *m_selector_insights);
+    }
+
+    document().style_invalidator().add_pending_invalidation(document(), invalidation_set.release_value());
+    return true;
+}
+
+bool StyleComputer::did_remove_style_rule(CSSStyleSheet const& sheet, CSSStyleRule const& rule)
+{
+    auto invalidation_set = invalidation_set_for_elements_matched_by(rule, document().in_quirks_mode());
+    if (!invalidation_set.has_value())
+        return false;
+
+    if (has_valid_rule_cache()) {
+        auto position = m_author_rule_cache->document_style_sheet_positions.find(&sheet);
+        if (position == m_author_rule_cache->document_style_sheet_positions.end())
+            return false;
+
+        // NOTE: The cascade order only compares rule indices, so the gap left by the removed rule doesn't matter.
+        auto& rule_caches = m_author_rule_cache->for_document;
+        rule_caches.main.remove_rule(position->value.style_sheet_index, rule);
+        for (auto& [_, rule_cache] : rule_caches.by_layer)
+            rule_cache->remove_rule(position->value.style_sheet_index, rule);
+        for (auto& rule_cache : m_pseudo_class_rule_cache) {
+            if (rule_cache)
+                rule_cache->remove_rule(position->value.style_sheet_index, rule);
+        }
+    }
+
+    document().style_invalidator().add_pending_invalidation(document(), invalidation_set.release_value());
+    return true;
+}
+
 void StyleComputer::invalidate_rule_cache()
 {
     m_author_rule_cache = nullptr;
@@ -3033,6 +3283,10 @@ void StyleComputer::invalidate_rule_cache()
 
     m_pseudo_class_rule_cache = {};
     m_style_invalidation_data = nullptr;
+    m_style_sharing_candidates.clear();
+    m_property_value_group_cache.clear();
+    if (m_has_result_cache.has_value())
+        m_has_result_cache->clear();
 }
 
 void StyleComputer::did_load_font(FlyString const&)
@@ -3216,35 +3470,30 @@ void StyleComputer::compute_math_depth(ComputedProperties& style, Optional<DOM::
     style.set_math_depth(inherited_math_depth());
 }
 
-static void for_each_element_hash(DOM::Element const& element, auto callback)
+StyleComputer::AncestorFilterScope::AncestorFilterScope(StyleComputer& style_computer)
+    : m_style_computer(style_computer)
+    , m_filter(make<AncestorFilter>())
+    , m_previous_filter(style_computer.m_ancestor_filter)
 {
-    callback(element.local_name().ascii_case_insensitive_hash());
-    if (element.id().has_value())
-        callback(element.id().value().hash());
-    for (auto const& class_ : element.class_names())
-        callback(class_.hash());
-    element.for_each_attribute([&](auto& attribute) {
-        callback(attribute.lowercase_name().hash());
-    });
+    m_style_computer.m_ancestor_filter = m_filter.ptr();
 }
 
-void StyleComputer::reset_ancestor_filter()
+StyleComputer::AncestorFilterScope::~AncestorFilterScope()
 {
-    m_ancestor_filter->clear();
+    VERIFY(m_style_computer.m_ancestor_filter == m_filter.ptr());
+    m_style_computer.m_ancestor_filter = m_previous_filter;
 }
 
 void StyleComputer::push_ancestor(DOM::Element const& element)
 {
-    for_each_element_hash(element, [&](u32 hash) {
-        m_ancestor_filter->increment(hash);
-    });
+    if (m_ancestor_filter)
+        m_ancestor_filter->push(element);
 }
 
 void StyleComputer::pop_ancestor(DOM::Element const& element)
 {
-    for_each_element_hash(element, [&](u32 hash) {
-        m_ancestor_filter->decrement(hash);
-    });
+    if (m_ancestor_filter)
+        m_ancestor_filter->pop(element);
 }
 
 size_t StyleComputer::number_of_css_font_faces_with_loading_in_progress() const
@@ -3274,23 +3523,92 @@ bool StyleComputer::have_has_selectors() const
     return m_selector_insights->has_has_selectors;
 }
 
+HasAnchorReach const& StyleComputer::has_anchor_reach() const
+{
+    build_rule_cache_if_needed();
+    return m_style_invalidation_data->has_anchor_reach;
+}
+
+Vector<MatchingRule>& RuleCache::bucket(BucketKey const& key)
+{
+    switch (key.type) {
+    case BucketKey::Type::Id:
+        return rules_by_id.ensure(key.name);
+    case BucketKey::Type::Class:
+        return rules_by_class.ensure(key.name);
+    case BucketKey::Type::TagName:
+        return rules_by_tag_name.ensure(key.name);
+    case BucketKey::Type::AttributeName:
+        return rules_by_attribute_name.ensure(key.name);
+    case BucketKey::Type::PseudoElement:
+        return rules_by_pseudo_element[key.pseudo_element_index];
+    case BucketKey::Type::Root:
+        return root_rules;
+    case BucketKey::Type::Other:
+        return other_rules;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+void RuleCache::add_rule_to_bucket(MatchingRule const& matching_rule, BucketKey key)
+{
+    auto& rules = bucket(key);
+    if (matching_rule.cascade_origin == CascadeOrigin::Author && !matching_rule.shadow_root)
+        m_locations_by_rule.ensure({ matching_rule.style_sheet_index, matching_rule.rule.ptr() }).append({ move(key), rules.size() });
+    rules.append(matching_rule);
+}
+
+void RuleCache::remove_rule_from_bucket(RuleLocation const& location)
+{
+    // NOTE: Matching rules are sorted into cascade order after they have been collected from the buckets, so the order
+    //       within a bucket doesn't matter, and the hole can be filled with the last entry of the bucket.
+    auto& rules = bucket(location.bucket);
+    auto last_index = rules.size() - 1;
+    auto last_rule = rules.take_last();
+    if (location.index_in_bucket == last_index)
+        return;
+
+    if (auto last_rule_locations = m_locations_by_rule.find({ last_rule.style_sheet_index, last_rule.rule.ptr() }); last_rule_locations != m_locations_by_rule.end()) {
+        for (auto& last_rule_location : last_rule_locations->value) {
+            if (last_rule_location.index_in_bucket == last_index && last_rule_location.bucket == location.bucket) {
+                last_rule_location.index_in_bucket = location.index_in_bucket;
+                break;
+            }
+        }
+    }
+    rules[location.index_in_bucket] = move(last_rule);
+}
+
+void RuleCache::remove_rule(size_t style_sheet_index, CSSRule const& rule)
+{
+    auto it = m_locations_by_rule.find({ style_sheet_index, &rule });
+    if (it == m_locations_by_rule.end())
+        return;
+
+    // NOTE: The locations stay in the map while the entries are removed, since the entry that fills a hole can be
+    //       another entry of the same rule.
+    while (!it->value.is_empty())
+        remove_rule_from_bucket(it->value.take_last());
+    m_locations_by_rule.remove(it);
+}
+
 void RuleCache::add_rule(MatchingRule const& matching_rule, Optional<PseudoElement> pseudo_element, bool contains_root_pseudo_class)
 {
     // NOTE: We traverse the simple selectors in reverse order to make sure that class/ID buckets are preferred over tag buckets
     //       in the common case of div.foo or div#foo selectors.
     auto add_to_id_bucket = [&](FlyString const& name) {
-        rules_by_id.ensure(name).append(matching_rule);
+        add_rule_to_bucket(matching_rule, { BucketKey::Type::Id, name });
     };
 
     auto add_to_class_bucket = [&](FlyString const& name) {
-        rules_by_class.ensure(name).append(matching_rule);
+        add_rule_to_bucket(matching_rule, { BucketKey::Type::Class, name });
     };
 
     auto add_to_tag_name_bucket = [&](FlyString const& name) {
-        rules_by_tag_name.ensure(name).append(matching_rule);
+        add_rule_to_bucket(matching_rule, { BucketKey::Type::TagName, name });
     };
 
-    for (auto const& simple_selector : matching_rule.selector.compound_selectors().last().simple_selectors.in_reverse()) {
+    for (auto const& simple_selector : matching_rule.selector->compound_selectors().last().simple_selectors.in_reverse()) {
         if (simple_selector.type == Selector::SimpleSelector::Type::Id) {
             add_to_id_bucket(simple_selector.name());
             return;
@@ -3322,20 +3640,20 @@ void RuleCache::add_rule(MatchingRule const& matching_rule, Optional<PseudoEleme
 
     if (matching_rule.contains_pseudo_element && pseudo_element.has_value()) {
         if (Selector::PseudoElementSelector::is_known_pseudo_element_type(pseudo_element.value())) {
-            rules_by_pseudo_element[to_underlying(pseudo_element.value())].append(matching_rule);
+            add_rule_to_bucket(matching_rule, { BucketKey::Type::PseudoElement, {}, to_underlying(pseudo_element.value()) });
         } else {
             // NOTE: We don't cache rules for unknown pseudo-elements. They can't match anything anyway.
         }
     } else if (contains_root_pseudo_class) {
-        root_rules.append(matching_rule);
+        add_rule_to_bucket(matching_rule, { BucketKey::Type::Root });
     } else {
-        for (auto const& simple_selector : matching_rule.selector.compound_selectors().last().simple_selectors) {
+        for (auto const& simple_selector : matching_rule.selector->compound_selectors().last().simple_selectors) {
             if (simple_selector.type == Selector::SimpleSelector::Type::Attribute) {
-                rules_by_attribute_name.ensure(simple_selector.attribute().qualified_name.name.lowercase_name).append(matching_rule);
+                add_rule_to_bucket(matching_rule, { BucketKey::Type::AttributeName, simple_selector.attribute().qualified_name.name.lowercase_name });
                 return;
             }
         }
-        other_rules.append(matching_rule);
+        add_rule_to_bucket(matching_rule, { BucketKey::Type::Other });
     }
 }
 
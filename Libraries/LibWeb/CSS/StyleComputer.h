@@ -8,6 +8,8 @@
 #pragma once
 
 #include <AK/HashMap.h>
+#include <AK/NonnullRawPtr.h>
+#include <AK/Noncopyable.h>
 #include <AK/Optional.h>
 #include <AK/OwnPtr.h>
 #include <LibGfx/Font/Typeface.h>
@@ -18,68 +20,21 @@
 #include <LibWeb/CSS/CSSStyleDeclaration.h>
 #include <LibWeb/CSS/CascadeOrigin.h>
 #include <LibWeb/CSS/CascadedProperties.h>
+#include <LibWeb/CSS/ComputedProperties.h>
 #include <LibWeb/CSS/Selector.h>
+#include <LibWeb/CSS/SelectorEngine.h>
 #include <LibWeb/CSS/StyleInvalidationData.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/Loader/ResourceLoader.h>
 
 namespace Web::CSS {
 
-// A counting bloom filter with 2 hash functions.
-// NOTE: If a counter overflows, it's kept maxed-out until the whole filter is cleared.
-template<typename CounterType, size_t key_bits>
-class CountingBloomFilter {
-public:
-    CountingBloomFilter() { }
-
-    void clear() { __builtin_memset(m_buckets, 0, sizeof(m_buckets)); }
-
-    void increment(u32 key)
-    {
-        auto& first = bucket1(key);
-        if (first < NumericLimits<CounterType>::max())
-            ++first;
-        auto& second = bucket2(key);
-        if (second < NumericLimits<CounterType>::max())
-            ++second;
-    }
-
-    void decrement(u32 key)
-    {
-        auto& first = bucket1(key);
-        if (first < NumericLimits<CounterType>::max())
-            --first;
-        auto& second = bucket2(key);
-        if (second < NumericLimits<CounterType>::max())
-            --second;
-    }
-
-    [[nodiscard]] bool may_contain(u32 hash) const
-    {
-        return bucket1(hash) && bucket2(hash);
-    }
-
-private:
-    static constexpr u32 bucket_count = 1 << key_bits;
-    static constexpr u32 key_mask = bucket_count - 1;
-
-    [[nodiscard]] u32 hash1(u32 key) const { return key & key_mask; }
-    [[nodiscard]] u32 hash2(u32 key) const { return (key >> 16) & key_mask; }
-
-    [[nodiscard]] CounterType& bucket1(u32 key) { return m_buckets[hash1(key)]; }
-    [[nodiscard]] CounterType& bucket2(u32 key) { return m_buckets[hash2(key)]; }
-    [[nodiscard]] CounterType bucket1(u32 key) const { return m_buckets[hash1(key)]; }
-    [[nodiscard]] CounterType bucket2(u32 key) const { return m_buckets[hash2(key)]; }
-
-    CounterType m_buckets[bucket_count];
-};
-
 struct MatchingRule {
     GC::Ptr<DOM::ShadowRoot const> shadow_root;
     GC::Ptr<CSSRule const> rule; // Either CSSStyleRule or CSSNestedDeclarations
     GC::Ptr<CSSStyleSheet const> sheet;
     Optional<FlyString> default_namespace;
-    Selector const& selector;
+    NonnullRawPtr<Selector const> selector;
     size_t style_sheet_index { 0 };
     size_t rule_index { 0 };
 
@@ -121,7 +76,51 @@ struct RuleCache {
     HashMap<FlyString, NonnullRefPtr<Animations::KeyframeEffect::KeyFrameSet>> rules_by_animation_keyframes;
 
     void add_rule(MatchingRule const&, Optional<PseudoElement>, bool contains_root_pseudo_class);
+    void remove_rule(size_t style_sheet_index, CSSRule const&);
     void for_each_matching_rules(DOM::Element const&, Optional<PseudoElement>, Function<IterationDecision(Vector<MatchingRule> const&)> callback) const;
+
+private:
+    struct BucketKey {
+        enum class Type : u8 {
+            Id,
+            Class,
+            TagName,
+            AttributeName,
+            PseudoElement,
+            Root,
+            Other,
+        };
+
+        Type type;
+        FlyString name {};
+        size_t pseudo_element_index { 0 };
+
+        bool operator==(BucketKey const&) const = default;
+    };
+
+    struct RuleLocation {
+        BucketKey bucket;
+        size_t index_in_bucket { 0 };
+    };
+
+    struct RuleKey {
+        size_t style_sheet_index { 0 };
+        CSSRule const* rule { nullptr };
+
+        bool operator==(RuleKey const&) const = default;
+    };
+
+    struct RuleKeyTraits : public DefaultTraits<RuleKey> {
+        static unsigned hash(RuleKey const& key) { return pair_int_hash(u64_hash(key.style_sheet_index), ptr_hash(key.rule)); }
+    };
+
+    Vector<MatchingRule>& bucket(BucketKey const&);
+    void add_rule_to_bucket(MatchingRule const&, BucketKey);
+    void remove_rule_from_bucket(RuleLocation const&);
+
+    // Where the entries of each rule were put, so that removing a rule only has to touch those entries.
+    // NOTE: Only rules from the document's author style sheets are ever removed one by one, so only those are tracked.
+    HashMap<RuleKey, Vector<RuleLocation, 1>, RuleKeyTraits> m_locations_by_rule;
 };
 
 class FontLoader;
@@ -143,7 +142,28 @@ public:
     DOM::Document& document() { return m_document; }
     DOM::Document const& document() const { return m_document; }
 
-    void reset_ancestor_filter();
+    void reset_style_sharing_cache();
+
+    // Gives a style computing tree walk an ancestor filter of its own. Until the scope ends, push_ancestor() and
+    // pop_ancestor() update that filter, and selector matching uses it to reject rules early. Outside of any walk, no
+    // rules are rejected that way.
+    class AncestorFilterScope {
+        AK_MAKE_NONCOPYABLE(AncestorFilterScope);
+        AK_MAKE_NONMOVABLE(AncestorFilterScope);
+
+    public:
+        explicit AncestorFilterScope(StyleComputer&);
+        ~AncestorFilterScope();
+
+    private:
+        StyleComputer& m_style_computer;
+        NonnullOwnPtr<AncestorFilter> m_filter;
+        AncestorFilter* m_previous_filter { nullptr };
+    };
+
+    // While enabled, the result of matching each :has() against each anchor is only computed once.
+    // Must only be enabled while neither the DOM nor the state of any element can change.
+    void set_caching_has_results(bool);
     void push_ancestor(DOM::Element const&);
     void pop_ancestor(DOM::Element const&);
 
@@ -162,6 +182,12 @@ public:
     [[nodiscard]] bool has_valid_rule_cache() const { return m_author_rule_cache; }
     void invalidate_rule_cache();
 
+    // Updates the rule caches in place and invalidates the style of the elements that the rule could match, after a
+    // style rule was appended to or removed from one of the document's style sheets. Returns false if that isn't
+    // possible, in which case the caller has to invalidate the rule caches and style as a whole.
+    [[nodiscard]] bool did_append_style_rule(CSSStyleSheet const&, CSSStyleRule const&);
+    [[nodiscard]] bool did_remove_style_rule(CSSStyleSheet const&, CSSStyleRule const&);
+
     Gfx::Font const& initial_font() const;
 
     void did_load_font(FlyString const& family_name);
@@ -187,6 +213,7 @@ public:
 
     [[nodiscard]] bool may_have_has_selectors() const;
     [[nodiscard]] bool have_has_selectors() const;
+    [[nodiscard]] HasAnchorReach const& has_anchor_reach() const;
 
     size_t number_of_css_font_faces_with_loading_in_progress() const;
 
@@ -195,8 +222,6 @@ public:
     void absolutize_values(ComputedProperties&, GC::Ptr<DOM::Element const>) const;
     void compute_font(ComputedProperties&, DOM::Element const*, Optional<CSS::PseudoElement>) const;
 
-    [[nodiscard]] inline bool should_reject_with_ancestor_filter(Selector const&) const;
-
     static NonnullRefPtr<StyleValue const> compute_value_of_custom_property(DOM::AbstractElement, FlyString const& custom_property, Optional<Parser::GuardedSubstitutionContexts&> = {});
 
 private:
@@ -224,6 +249,9 @@ private:
 
     LogicalAliasMappingContext compute_logical_alias_mapping_context(DOM::Element&, Optional<CSS::PseudoElement>, ComputeStyleMode, MatchingRuleSet const&) const;
     [[nodiscard]] GC::Ptr<ComputedProperties> compute_style_impl(DOM::Element&, Optional<CSS::PseudoElement>, ComputeStyleMode, Optional<bool&> did_change_custom_properties) const;
+    [[nodiscard]] bool may_share_style(DOM::Element const&) const;
+    [[nodiscard]] GC::Ptr<ComputedProperties> share_style_with_sibling(DOM::Element&, Optional<bool&> did_change_custom_properties) const;
+    void remember_shareable_style(DOM::Element&, ComputedProperties&) const;
     [[nodiscard]] GC::Ref<CascadedProperties> compute_cascaded_values(DOM::Element&, Optional<CSS::PseudoElement>, bool did_match_any_pseudo_element_rules, ComputeStyleMode, MatchingRuleSet const&, Optional<LogicalAliasMappingContext>, ReadonlySpan<PropertyID> properties_to_cascade) const;
     static RefPtr<Gfx::FontCascadeList const> find_matching_font_weight_ascending(Vector<MatchingFontCandidate> const& candidates, int target_weight, float font_size_in_pt, bool inclusive);
     static RefPtr<Gfx::FontCascadeList const> find_matching_font_weight_descending(Vector<MatchingFontCandidate> const& candidates, int target_weight, float font_size_in_pt, bool inclusive);
@@ -269,12 +297,20 @@ private:
         HashMap<FlyString, NonnullOwnPtr<RuleCache>> by_layer;
     };
 
+    struct StyleSheetPosition {
+        size_t style_sheet_index { 0 };
+        size_t next_rule_index { 0 };
+    };
+
     struct RuleCachesForDocumentAndShadowRoots {
         RuleCaches for_document;
         HashMap<GC::Ref<DOM::ShadowRoot const>, NonnullOwnPtr<RuleCaches>> for_shadow_roots;
+        // Where the rules of each of the document's (not shadow roots') author style sheets were put in the cascade order.
+        HashMap<CSSStyleSheet const*, StyleSheetPosition> document_style_sheet_positions;
     };
 
     void make_rule_cache_for_cascade_origin(CascadeOrigin, SelectorInsights&);
+    void add_rule_to_rule_caches(RuleCaches&, CSSRule const&, CSSStyleSheet const&, GC::Ptr<DOM::ShadowRoot const>, CascadeOrigin, size_t style_sheet_index, size_t rule_index, SelectorInsights&);
 
     [[nodiscard]] RuleCache const* rule_cache_for_cascade_origin(CascadeOrigin, Optional<FlyString const> qualified_layer_name, GC::Ptr<DOM::ShadowRoot const>) const;
 
@@ -298,7 +334,22 @@ private:
 
     CSSPixelRect m_viewport_rect;
 
-    OwnPtr<CountingBloomFilter<u8, 14>> m_ancestor_filter;
+    // The filter of the style computing tree walk in progress, if any.
+    AncestorFilter* m_ancestor_filter { nullptr };
+
+    // Elements whose style was computed during the current style update, and that siblings may copy it from.
+    struct StyleSharingCandidate {
+        GC::Ref<DOM::Element> element;
+        GC::Ref<ComputedProperties> style;
+        GC::Ref<DOM::Element const> parent;
+        GC::Ref<ComputedProperties const> parent_style;
+    };
+    static constexpr size_t style_sharing_cache_size = 8;
+    mutable Vector<StyleSharingCandidate, style_sharing_cache_size> m_style_sharing_candidates;
+
+    mutable PropertyValueGroupCache m_property_value_group_cache;
+
+    mutable Optional<SelectorEngine::HasResultCache> m_has_result_cache;
 };
 
 class FontLoader final : public GC::Cell {
@@ -335,15 +386,4 @@ private:
     Function<void(RefPtr<Gfx::Typeface const>)> m_on_load;
 };
 
-inline bool StyleComputer::should_reject_with_ancestor_filter(Selector const& selector) const
-{
-    for (u32 hash : selector.ancestor_hashes()) {
-        if (hash == 0)
-            break;
-        if (!m_ancestor_filter->may_contain(hash))
-            return true;
-    }
-    return false;
-}
-
 }
@@ -66,6 +66,11 @@ RequiredInvalidationAfterStyleChange compute_property_invalidation(CSS::Property
         if (old_value_opacity != new_value_opacity && (old_value_opacity == 1 || new_value_opacity == 1)) {
             invalidation.rebuild_stacking_context_tree = true;
         }
+    } else if (AK::first_is_one_of(property_id, CSS::PropertyID::Transform, CSS::PropertyID::Rotate, CSS::PropertyID::Scale, CSS::PropertyID::Translate) && old_value && new_value) {
+        // OPTIMIZATION: Likewise, an element only creates a stacking context for a transform that isn't `none`, so
+        //               changes from one transform to another don't require a stacking context tree rebuild.
+        if ((old_value->to_keyword() == CSS::Keyword::None) != (new_value->to_keyword() == CSS::Keyword::None))
+            invalidation.rebuild_stacking_context_tree = true;
     } else if (CSS::property_affects_stacking_context(property_id)) {
         invalidation.rebuild_stacking_context_tree = true;
     }
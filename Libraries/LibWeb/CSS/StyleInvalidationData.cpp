@@ -110,6 +110,54 @@ static InvalidationSet build_invalidation_sets_for_selector_impl(StyleInvalidati
 
 static void add_invalidation_sets_to_cover_scope_leakage_of_relative_selector_in_has_pseudo_class(Selector const& selector, StyleInvalidationData& style_invalidation_data);
 
+static void extend_has_anchor_reach_for_relative_selector(Selector const& selector, StyleInvalidationData& style_invalidation_data)
+{
+    auto& reach = style_invalidation_data.has_anchor_reach;
+
+    size_t ancestor_distance = 0;
+    bool uses_sibling_combinators = false;
+    bool depends_on_other_elements = false;
+    for (auto const& compound_selector : selector.compound_selectors()) {
+        switch (compound_selector.combinator) {
+        case Selector::Combinator::Descendant:
+            ancestor_distance = HasAnchorReach::any_ancestor_distance;
+            break;
+        case Selector::Combinator::ImmediateChild:
+            if (ancestor_distance != HasAnchorReach::any_ancestor_distance)
+                ++ancestor_distance;
+            break;
+        case Selector::Combinator::NextSibling:
+        case Selector::Combinator::SubsequentSibling:
+            uses_sibling_combinators = true;
+            break;
+        default:
+            break;
+        }
+
+        // Whether a compound matches may also depend on the element's descendants, siblings or on arbitrary other
+        // elements through nested selectors, which puts the anchor out of the reach computed from the combinators.
+        for (auto const& simple_selector : compound_selector.simple_selectors) {
+            if (simple_selector.type != Selector::SimpleSelector::Type::PseudoClass)
+                continue;
+            auto const& pseudo_class = simple_selector.pseudo_class();
+            if (!pseudo_class.argument_selector_list.is_empty()
+                || AK::first_is_one_of(pseudo_class.type, PseudoClass::Empty, PseudoClass::FocusWithin, PseudoClass::FirstChild, PseudoClass::LastChild, PseudoClass::OnlyChild, PseudoClass::FirstOfType, PseudoClass::LastOfType, PseudoClass::OnlyOfType, PseudoClass::NthChild, PseudoClass::NthLastChild, PseudoClass::NthOfType, PseudoClass::NthLastOfType)) {
+                depends_on_other_elements = true;
+            }
+        }
+    }
+
+    if (depends_on_other_elements) {
+        reach.max_ancestor_distance = HasAnchorReach::any_ancestor_distance;
+        reach.siblings = HasAnchorReach::Siblings::All;
+        return;
+    }
+
+    reach.max_ancestor_distance = max(reach.max_ancestor_distance, ancestor_distance);
+    if (uses_sibling_combinators && reach.siblings == HasAnchorReach::Siblings::None)
+        reach.siblings = HasAnchorReach::Siblings::Preceding;
+}
+
 static void build_invalidation_sets_for_simple_selector(Selector::SimpleSelector const& selector, InvalidationSet& invalidation_set, ExcludePropertiesNestedInNotPseudoClass exclude_properties_nested_in_not_pseudo_class, StyleInvalidationData& style_invalidation_data, InsideNthChildPseudoClass inside_nth_child_selector)
 {
     switch (selector.type) {
@@ -136,6 +184,8 @@ static void build_invalidation_sets_for_simple_selector(Selector::SimpleSelector
         case PseudoClass::Has: {
             for (auto const& nested_selector : pseudo_class.argument_selector_list) {
                 add_invalidation_sets_to_cover_scope_leakage_of_relative_selector_in_has_pseudo_class(*nested_selector, style_invalidation_data);
+                if (pseudo_class.type == PseudoClass::Has)
+                    extend_has_anchor_reach_for_relative_selector(*nested_selector, style_invalidation_data);
             }
             [[fallthrough]];
         }
@@ -7,11 +7,31 @@
 #pragma once
 
 #include <AK/HashMap.h>
+#include <AK/NumericLimits.h>
 #include <LibWeb/CSS/InvalidationSet.h>
 #include <LibWeb/Forward.h>
 
 namespace Web::CSS {
 
+// Where the anchors of the :has() pseudo-classes whose result may be changed by a change to an element can be found,
+// relative to that element.
+struct HasAnchorReach {
+    static constexpr size_t any_ancestor_distance = NumericLimits<size_t>::max();
+
+    enum class Siblings : u8 {
+        None,
+        // Anchors may be preceding siblings of the element or of one of the ancestors within max_ancestor_distance.
+        Preceding,
+        // Anchors may be any sibling of the element or of one of its ancestors.
+        All,
+    };
+
+    // The number of ancestors of the element that may be anchors, i.e. the number of child combinators in the
+    // relative selectors, or any_ancestor_distance if one of them uses a descendant combinator.
+    size_t max_ancestor_distance { 0 };
+    Siblings siblings { Siblings::None };
+};
+
 struct StyleInvalidationData {
     HashMap<InvalidationSet::Property, InvalidationSet> descendant_invalidation_sets;
     HashTable<FlyString> ids_used_in_has_selectors;
@@ -19,6 +39,7 @@ struct StyleInvalidationData {
     HashTable<FlyString> attribute_names_used_in_has_selectors;
     HashTable<FlyString> tag_names_used_in_has_selectors;
     HashTable<PseudoClass> pseudo_classes_used_in_has_selectors;
+    HasAnchorReach has_anchor_reach;
 
     void build_invalidation_sets_for_selector(Selector const& selector);
 };
@@ -2778,6 +2778,234 @@ void CalculatedStyleValue::CalculationResult::invert()
         m_type = m_type->inverted();
 }
 
+// A calculation tree made up of only numeric values, sums, products, negations and inversions, flattened into a
+// postfix program. This covers what most calc() expressions look like after simplification. Evaluating the program
+// gives the same value as CalculationNode::resolve(), without the virtual calls, or combining the types of the
+// intermediate results at every node.
+template<typename>
+constexpr size_t percentage_basis_kind_count = 0;
+template<typename... Kinds>
+constexpr size_t percentage_basis_kind_count<Variant<Kinds...>> = sizeof...(Kinds);
+
+class CalculationProgram {
+public:
+    static OwnPtr<CalculationProgram const> compile(CalculationNode const& calculation)
+    {
+        auto program = make<CalculationProgram>();
+        if (!program->compile_node(calculation))
+            return nullptr;
+        // NOTE: The type of the result doesn't depend on any values, only on which kind of percentage basis we have.
+        //       So we work it out for each kind of basis up front, and never have to touch the program again.
+        for (size_t index = 0; index < program->m_result_type_by_percentage_basis_index.size(); ++index)
+            program->m_result_type_by_percentage_basis_index[index] = program->result_type(percentage_basis_of_kind(index));
+        return program;
+    }
+
+    CalculatedStyleValue::CalculationResult evaluate(CalculationResolutionContext const& context) const
+    {
+        Vector<double, 8> stack;
+        for (auto const& instruction : m_instructions) {
+            instruction.visit(
+                [&](PushConstant const& push) {
+                    stack.append(push.value);
+                },
+                [&](PushLength const& push) {
+                    stack.append(CalculatedStyleValue::CalculationResult::from_value(push.length, context, {}).value());
+                },
+                [&](PushPercentage const& push) {
+                    stack.append(context.percentage_basis.visit(
+                        [&](Empty const&) { return push.percentage.value(); },
+                        [&](auto const& basis) { return CalculatedStyleValue::CalculationResult::from_value(basis.percentage_of(push.percentage), context, {}).value(); }));
+                },
+                [&](Add const& add) {
+                    auto first_operand = stack.size() - add.operand_count;
+                    for (auto i = first_operand + 1; i < stack.size(); ++i)
+                        stack[first_operand] = stack[first_operand] + stack[i];
+                    stack.shrink(first_operand + 1, true);
+                },
+                [&](Multiply const& multiply) {
+                    auto first_operand = stack.size() - multiply.operand_count;
+                    for (auto i = first_operand + 1; i < stack.size(); ++i)
+                        stack[first_operand] = stack[first_operand] * stack[i];
+                    stack.shrink(first_operand + 1, true);
+                },
+                [&](Negate const&) {
+                    stack.last() = 0 - stack.last();
+                },
+                [&](Invert const&) {
+                    stack.last() = 1.0 / stack.last();
+                });
+        }
+        VERIFY(stack.size() == 1);
+
+        return { stack.first(), m_result_type_by_percentage_basis_index[context.percentage_basis.index()] };
+    }
+
+private:
+    struct PushConstant {
+        double value;
+        Optional<NumericType> type;
+    };
+    struct PushLength {
+        Length length;
+        Optional<NumericType> type;
+    };
+    struct PushPercentage {
+        Percentage percentage;
+        Optional<NumericType> type;
+    };
+    struct Add {
+        size_t operand_count;
+    };
+    struct Multiply {
+        size_t operand_count;
+    };
+    struct Negate { };
+    struct Invert { };
+    using Instruction = Variant<PushConstant, PushLength, PushPercentage, Add, Multiply, Negate, Invert>;
+
+    // Only the kind of a percentage basis affects the type of the result, so any value of that kind will do.
+    static PercentageBasis percentage_basis_of_kind(size_t index)
+    {
+        static_assert(percentage_basis_kind_count<PercentageBasis> == 5, "Add a value for the new kind of percentage basis");
+        PercentageBasis basis;
+        switch (index) {
+        case 0:
+            basis = Empty {};
+            break;
+        case 1:
+            basis = Angle::make_degrees(0);
+            break;
+        case 2:
+            basis = Frequency::make_hertz(0);
+            break;
+        case 3:
+            basis = Length::make_px(0);
+            break;
+        case 4:
+            basis = Time::make_seconds(0);
+            break;
+        default:
+            VERIFY_NOT_REACHED();
+        }
+        VERIFY(basis.index() == index);
+        return basis;
+    }
+
+    // Combines the types of the instructions' operands the same way CalculationResult does when resolving the tree.
+    Optional<NumericType> result_type(PercentageBasis const& percentage_basis) const
+    {
+        Vector<Optional<NumericType>, 8> stack;
+        for (auto const& instruction : m_instructions) {
+            instruction.visit(
+                [&](PushConstant const& push) {
+                    stack.append(push.type);
+                },
+                [&](PushLength const& push) {
+                    stack.append(push.type);
+                },
+                [&](PushPercentage const& push) {
+                    stack.append(percentage_basis.visit(
+                        [&](Empty const&) { return push.type; },
+                        [&](auto const& basis) -> Optional<NumericType> { return numeric_type_from_calculated_style_value(basis.percentage_of(push.percentage), {}); }));
+                },
+                [&](Add const& add) {
+                    auto first_operand = stack.size() - add.operand_count;
+                    for (auto i = first_operand + 1; i < stack.size(); ++i) {
+                        auto& total = stack[first_operand];
+                        total = total.has_value() && stack[i].has_value() ? total->added_to(*stack[i]) : OptionalNone {};
+                    }
+                    stack.shrink(first_operand + 1, true);
+                },
+                [&](Multiply const& multiply) {
+                    auto first_operand = stack.size() - multiply.operand_count;
+                    for (auto i = first_operand + 1; i < stack.size(); ++i) {
+                        auto& total = stack[first_operand];
+                        total = total.has_value() && stack[i].has_value() ? total->multiplied_by(*stack[i]) : OptionalNone {};
+                    }
+                    stack.shrink(first_operand + 1, true);
+                },
+                [&](Negate const&) {
+                    // Negating a value doesn't change its type.
+                },
+                [&](Invert const&) {
+                    if (stack.last().has_value())
+                        stack.last() = stack.last()->inverted();
+                });
+        }
+        VERIFY(stack.size() == 1);
+
+        return stack.first();
+    }
+
+    bool compile_node(CalculationNode const& node)
+    {
+        switch (node.type()) {
+        case CalculationNode::Type::Numeric: {
+            auto const& value = as<NumericCalculationNode>(node).value();
+            if (auto const* percentage = value.get_pointer<Percentage>()) {
+                m_instructions.append(PushPercentage { *percentage, node.numeric_type() });
+                return true;
+            }
+            if (auto const* length = value.get_pointer<Length>(); length && !length->is_auto() && !length->is_absolute()) {
+                m_instructions.append(PushLength { *length, node.numeric_type() });
+                return true;
+            }
+            // Everything else resolves to the same value regardless of the context, so we can do that right away.
+            m_instructions.append(PushConstant { CalculatedStyleValue::CalculationResult::from_value(value, {}, {}).value(), node.numeric_type() });
+            return true;
+        }
+        case CalculationNode::Type::Sum:
+        case CalculationNode::Type::Product: {
+            auto children = node.children();
+            for (auto const& child : children) {
+                if (!compile_node(child))
+                    return false;
+            }
+            if (node.type() == CalculationNode::Type::Sum)
+                m_instructions.append(Add { children.size() });
+            else
+                m_instructions.append(Multiply { children.size() });
+            return true;
+        }
+        case CalculationNode::Type::Negate:
+            if (!compile_node(as<NegateCalculationNode>(node).child()))
+                return false;
+            m_instructions.append(Negate {});
+            return true;
+        case CalculationNode::Type::Invert:
+            if (!compile_node(as<InvertCalculationNode>(node).child()))
+                return false;
+            m_instructions.append(Invert {});
+            return true;
+        default:
+            // The result types of comparison and math functions depend on the values involved.
+            return false;
+        }
+    }
+
+    Vector<Instruction> m_instructions;
+    Array<Optional<NumericType>, percentage_basis_kind_count<PercentageBasis>> m_result_type_by_percentage_basis_index;
+};
+
+CalculatedStyleValue::CalculatedStyleValue(NonnullRefPtr<CalculationNode const> calculation, NumericType resolved_type, CalculationContext context)
+    : StyleValue(Type::Calculated)
+    , m_resolved_type(move(resolved_type))
+    , m_calculation(move(calculation))
+    , m_context(move(context))
+    , m_program(CalculationProgram::compile(m_calculation))
+{
+}
+
+CalculatedStyleValue::~CalculatedStyleValue() = default;
+
+CalculatedStyleValue::CalculationResult CalculatedStyleValue::resolve_calculation(CalculationResolutionContext const& context) const
+{
+    if (!m_program)
+        return m_calculation->resolve(context);
+    return m_program->evaluate(context);
+}
+
 String CalculatedStyleValue::to_string(SerializationMode serialization_mode) const
 {
     return serialize_a_math_function(m_calculation, m_context, serialization_mode);
@@ -2858,7 +3086,7 @@ Optional<CalculatedStyleValue::ResolvedValue> CalculatedStyleValue::resolve_valu
 
 Optional<Angle> CalculatedStyleValue::resolve_angle_deprecated(CalculationResolutionContext const& context) const
 {
-    auto result = m_calculation->resolve(context);
+    auto result = resolve_calculation(context);
     if (result.type().has_value() && result.type()->matches_angle(m_context.percentages_resolve_as))
         return Angle::make_degrees(result.value());
     return {};
@@ -2876,7 +3104,7 @@ Optional<Angle> CalculatedStyleValue::resolve_angle(CalculationResolutionContext
 
 Optional<Flex> CalculatedStyleValue::resolve_flex_deprecated(CalculationResolutionContext const& context) const
 {
-    auto result = m_calculation->resolve(context);
+    auto result = resolve_calculation(context);
     if (result.type().has_value() && result.type()->matches_flex(m_context.percentages_resolve_as))
         return Flex::make_fr(result.value());
     return {};
@@ -2894,7 +3122,7 @@ Optional<Flex> CalculatedStyleValue::resolve_flex(CalculationResolutionContext c
 
 Optional<Frequency> CalculatedStyleValue::resolve_frequency_deprecated(CalculationResolutionContext const& context) const
 {
-    auto result = m_calculation->resolve(context);
+    auto result = resolve_calculation(context);
     if (result.type().has_value() && result.type()->matches_frequency(m_context.percentages_resolve_as))
         return Frequency::make_hertz(result.value());
     return {};
@@ -2912,7 +3140,7 @@ Optional<Frequency> CalculatedStyleValue::resolve_frequency(CalculationResolutio
 
 Optional<Length> CalculatedStyleValue::resolve_length_deprecated(CalculationResolutionContext const& context) const
 {
-    auto result = m_calculation->resolve(context);
+    auto result = resolve_calculation(context);
     if (result.type().has_value() && result.type()->matches_length(m_context.percentages_resolve_as))
         return Length::make_px(result.value());
     return {};
@@ -2930,7 +3158,7 @@ Optional<Length> CalculatedStyleValue::resolve_length(CalculationResolutionConte
 
 Optional<Percentage> CalculatedStyleValue::resolve_percentage_deprecated(CalculationResolutionContext const& context) const
 {
-    auto result = m_calculation->resolve(context);
+    auto result = resolve_calculation(context);
     if (result.type().has_value() && result.type()->matches_percentage())
         return Percentage { result.value() };
     return {};
@@ -2948,7 +3176,7 @@ Optional<Percentage> CalculatedStyleValue::resolve_percentage(CalculationResolut
 
 Optional<Resolution> CalculatedStyleValue::resolve_resolution_deprecated(CalculationResolutionContext const& context) const
 {
-    auto result = m_calculation->resolve(context);
+    auto result = resolve_calculation(context);
     if (result.type().has_value() && result.type()->matches_resolution(m_context.percentages_resolve_as))
         return Resolution::make_dots_per_pixel(result.value());
     return {};
@@ -2966,7 +3194,7 @@ Optional<Resolution> CalculatedStyleValue::resolve_resolution(CalculationResolut
 
 Optional<Time> CalculatedStyleValue::resolve_time_deprecated(CalculationResolutionContext const& context) const
 {
-    auto result = m_calculation->resolve(context);
+    auto result = resolve_calculation(context);
     if (result.type().has_value() && result.type()->matches_time(m_context.percentages_resolve_as))
         return Time::make_seconds(result.value());
     return {};
@@ -2984,7 +3212,7 @@ Optional<Time> CalculatedStyleValue::resolve_time(CalculationResolutionContext c
 
 Optional<double> CalculatedStyleValue::resolve_number_deprecated(CalculationResolutionContext const& context) const
 {
-    auto result = m_calculation->resolve(context);
+    auto result = resolve_calculation(context);
     if (!result.type().has_value() || !result.type()->matches_number(m_context.percentages_resolve_as))
         return {};
 
@@ -3009,7 +3237,7 @@ Optional<double> CalculatedStyleValue::resolve_number(CalculationResolutionConte
 
 Optional<i64> CalculatedStyleValue::resolve_integer_deprecated(CalculationResolutionContext const& context) const
 {
-    auto result = m_calculation->resolve(context);
+    auto result = resolve_calculation(context);
     if (result.type().has_value() && result.type()->matches_number(m_context.percentages_resolve_as))
         return llround(result.value());
     return {};
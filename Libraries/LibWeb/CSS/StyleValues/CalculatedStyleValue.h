@@ -10,6 +10,7 @@
 #pragma once
 
 #include <AK/Function.h>
+#include <AK/OwnPtr.h>
 #include <LibWeb/CSS/Angle.h>
 #include <LibWeb/CSS/Enums.h>
 #include <LibWeb/CSS/Flex.h>
@@ -25,6 +26,7 @@
 namespace Web::CSS {
 
 class CalculationNode;
+class CalculationProgram;
 
 // https://drafts.csswg.org/css-values-4/#calc-context
 // Contains the context available at parse-time.
@@ -68,6 +70,7 @@ public:
     {
         return adopt_ref(*new (nothrow) CalculatedStyleValue(move(calculation), move(resolved_type), move(context)));
     }
+    virtual ~CalculatedStyleValue() override;
 
     virtual String to_string(SerializationMode) const override;
     virtual ValueComparingNonnullRefPtr<StyleValue const> absolutized(CSSPixelRect const& viewport_rect, Length::FontMetrics const& font_metrics, Length::FontMetrics const& root_font_metrics) const override;
@@ -118,25 +121,24 @@ public:
     String dump() const;
 
 private:
-    explicit CalculatedStyleValue(NonnullRefPtr<CalculationNode const> calculation, NumericType resolved_type, CalculationContext context)
-        : StyleValue(Type::Calculated)
-        , m_resolved_type(move(resolved_type))
-        , m_calculation(move(calculation))
-        , m_context(move(context))
-    {
-    }
+    explicit CalculatedStyleValue(NonnullRefPtr<CalculationNode const> calculation, NumericType resolved_type, CalculationContext context);
 
     struct ResolvedValue {
         double value;
         Optional<NumericType> type;
     };
     Optional<ResolvedValue> resolve_value(CalculationResolutionContext const&) const;
+    CalculationResult resolve_calculation(CalculationResolutionContext const&) const;
 
     Optional<ValueType> percentage_resolved_type() const;
 
     NumericType m_resolved_type;
     NonnullRefPtr<CalculationNode const> m_calculation;
     CalculationContext m_context;
+
+    // Compiled when the value is created, if it can be. Never changes afterwards, so that the value can be resolved
+    // from any thread.
+    OwnPtr<CalculationProgram const> m_program;
 };
 
 // https://www.w3.org/TR/css-values-4/#calculation-tree
@@ -21,6 +21,28 @@ namespace Web::CSS {
 
 ValueComparingNonnullRefPtr<ColorStyleValue const> ColorStyleValue::create_from_color(Color color, ColorSyntax color_syntax, Optional<FlyString> name)
 {
+    // Pages tend to use a small palette of colors over and over, and every computed color goes through here, so share
+    // the instances for recently used colors. Rather than tracking how recently each color was used, start over once
+    // there are too many of them.
+    static constexpr size_t max_shared_color_count = 256;
+    static HashMap<u64, ValueComparingNonnullRefPtr<ColorStyleValue const>> shared_instances;
+    if (!name.has_value()) {
+        verify_shared_style_values_can_be_used();
+        u64 key = (static_cast<u64>(color.value()) << 8) | to_underlying(color_syntax);
+        if (auto instance = shared_instances.get(key); instance.has_value())
+            return *instance;
+        if (shared_instances.size() >= max_shared_color_count)
+            shared_instances.clear();
+        auto instance = RGBColorStyleValue::create(
+            NumberStyleValue::create(color.red()),
+            NumberStyleValue::create(color.green()),
+            NumberStyleValue::create(color.blue()),
+            NumberStyleValue::create(color.alpha() / 255.0),
+            color_syntax);
+        shared_instances.set(key, instance);
+        return instance;
+    }
+
     return RGBColorStyleValue::create(
         NumberStyleValue::create(color.red()),
         NumberStyleValue::create(color.green()),
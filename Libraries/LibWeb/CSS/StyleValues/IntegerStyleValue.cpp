@@ -10,6 +10,19 @@
 
 namespace Web::CSS {
 
+ValueComparingNonnullRefPtr<IntegerStyleValue const> IntegerStyleValue::create(i64 value)
+{
+    static Array<RefPtr<IntegerStyleValue const>, 1001> shared_instances;
+    if (value >= 0 && static_cast<size_t>(value) < shared_instances.size()) {
+        verify_shared_style_values_can_be_used();
+        auto& instance = shared_instances[value];
+        if (!instance)
+            instance = adopt_ref(*new (nothrow) IntegerStyleValue(value));
+        return *instance;
+    }
+    return adopt_ref(*new (nothrow) IntegerStyleValue(value));
+}
+
 String IntegerStyleValue::to_string(SerializationMode) const
 {
     return String::number(m_value);
@@ -12,10 +12,7 @@ namespace Web::CSS {
 
 class IntegerStyleValue final : public StyleValue {
 public:
-    static ValueComparingNonnullRefPtr<IntegerStyleValue const> create(i64 value)
-    {
-        return adopt_ref(*new (nothrow) IntegerStyleValue(value));
-    }
+    static ValueComparingNonnullRefPtr<IntegerStyleValue const> create(i64 value);
 
     i64 integer() const { return m_value; }
 
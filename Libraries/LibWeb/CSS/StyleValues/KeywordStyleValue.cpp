@@ -17,6 +17,17 @@
 
 namespace Web::CSS {
 
+ValueComparingNonnullRefPtr<KeywordStyleValue const> KeywordStyleValue::create(Keyword keyword)
+{
+    // There's only a fixed number of keywords, so every one of them gets a single shared instance.
+    static Array<RefPtr<KeywordStyleValue const>, to_underlying(last_keyword) + 1> instances;
+    verify_shared_style_values_can_be_used();
+    auto& instance = instances[to_underlying(keyword)];
+    if (!instance)
+        instance = adopt_ref(*new (nothrow) KeywordStyleValue(keyword));
+    return *instance;
+}
+
 String KeywordStyleValue::to_string(SerializationMode) const
 {
     return MUST(String::from_utf8(string_from_keyword(keyword())));
@@ -15,13 +15,13 @@ ValueComparingNonnullRefPtr<LengthStyleValue const> LengthStyleValue::create(Len
 {
     VERIFY(!length.is_auto());
     if (length.is_px()) {
-        if (length.raw_value() == 0) {
-            static auto value = adopt_ref(*new (nothrow) LengthStyleValue(CSS::Length::make_px(0)));
-            return value;
-        }
-        if (length.raw_value() == 1) {
-            static auto value = adopt_ref(*new (nothrow) LengthStyleValue(CSS::Length::make_px(1)));
-            return value;
+        static Array<RefPtr<LengthStyleValue const>, 129> shared_instances;
+        if (auto index = shared_style_value_index(length.raw_value(), shared_instances.size()); index.has_value()) {
+            verify_shared_style_values_can_be_used();
+            auto& instance = shared_instances[*index];
+            if (!instance)
+                instance = adopt_ref(*new (nothrow) LengthStyleValue(length));
+            return *instance;
         }
     }
     return adopt_ref(*new (nothrow) LengthStyleValue(length));
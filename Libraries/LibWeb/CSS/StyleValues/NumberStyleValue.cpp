@@ -14,6 +14,19 @@
 
 namespace Web::CSS {
 
+ValueComparingNonnullRefPtr<NumberStyleValue const> NumberStyleValue::create(double value)
+{
+    static Array<RefPtr<NumberStyleValue const>, 1001> shared_instances;
+    if (auto index = shared_style_value_index(value, shared_instances.size()); index.has_value()) {
+        verify_shared_style_values_can_be_used();
+        auto& instance = shared_instances[*index];
+        if (!instance)
+            instance = adopt_ref(*new (nothrow) NumberStyleValue(value));
+        return *instance;
+    }
+    return adopt_ref(*new (nothrow) NumberStyleValue(value));
+}
+
 String NumberStyleValue::to_string(SerializationMode) const
 {
     return serialize_a_number(m_value);
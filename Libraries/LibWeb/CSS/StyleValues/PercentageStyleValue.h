@@ -18,6 +18,14 @@ class PercentageStyleValue final : public DimensionStyleValue {
 public:
     static ValueComparingNonnullRefPtr<PercentageStyleValue const> create(Percentage percentage)
     {
+        static Array<RefPtr<PercentageStyleValue const>, 101> shared_instances;
+        if (auto index = shared_style_value_index(percentage.value(), shared_instances.size()); index.has_value()) {
+            verify_shared_style_values_can_be_used();
+            auto& instance = shared_instances[*index];
+            if (!instance)
+                instance = adopt_ref(*new (nothrow) PercentageStyleValue(move(percentage)));
+            return *instance;
+        }
         return adopt_ref(*new (nothrow) PercentageStyleValue(move(percentage)));
     }
     virtual ~PercentageStyleValue() override = default;
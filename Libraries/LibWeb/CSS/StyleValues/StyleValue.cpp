@@ -73,9 +73,15 @@
 #include <LibWeb/CSS/StyleValues/UnicodeRangeStyleValue.h>
 #include <LibWeb/CSS/StyleValues/UnresolvedStyleValue.h>
 #include <LibWeb/Layout/Node.h>
+#include <LibWeb/Layout/ParallelLayout.h>
 
 namespace Web::CSS {
 
+void verify_shared_style_values_can_be_used()
+{
+    VERIFY(!Layout::is_running_layout_tasks());
+}
+
 ColorResolutionContext ColorResolutionContext::for_element(DOM::AbstractElement const& element)
 {
     auto color_scheme = element.computed_properties()->color_scheme(element.document().page().preferred_color_scheme(), element.document().supported_color_schemes());
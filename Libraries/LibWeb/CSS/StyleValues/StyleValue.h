@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/GenericShorthands.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/RefCounted.h>
@@ -26,6 +27,7 @@
 #include <LibWeb/CSS/PreferredColorScheme.h>
 #include <LibWeb/CSS/SerializationMode.h>
 #include <LibWeb/Forward.h>
+#include <math.h>
 
 namespace Web::CSS {
 
@@ -143,6 +145,20 @@ private:
 
 using StyleValueVector = Vector<ValueComparingNonnullRefPtr<StyleValue const>>;
 
+// Small whole numbers are by far the most common numeric values in style sheets and computed styles (e.g. 0px, 100%,
+// color channels and font weights), so numeric style values share a single instance for each of them. This returns
+// the index of the shared instance for the given value, if there is one.
+inline Optional<size_t> shared_style_value_index(double value, size_t shared_value_count)
+{
+    if (!(value >= 0 && value < shared_value_count) || trunc(value) != value || signbit(value))
+        return {};
+    return static_cast<size_t>(value);
+}
+
+// Neither the tables of shared style value instances nor the reference counts of the instances are thread-safe, so
+// they must not be used from layout tasks that may run on other threads (see Layout/ParallelLayout.h).
+void verify_shared_style_values_can_be_used();
+
 struct ColorResolutionContext {
     Optional<PreferredColorScheme> color_scheme;
     Optional<Color> current_color;
@@ -34,6 +34,7 @@
 #include <LibWeb/Bindings/DocumentPrototype.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/Bindings/PrincipalHostDefined.h>
+#include <LibWeb/CSS/AncestorFilter.h>
 #include <LibWeb/CSS/AnimationEvent.h>
 #include <LibWeb/CSS/CSSAnimation.h>
 #include <LibWeb/CSS/CSSImportRule.h>
@@ -149,11 +150,13 @@
 #include <LibWeb/Infra/Strings.h>
 #include <LibWeb/IntersectionObserver/IntersectionObserver.h>
 #include <LibWeb/Layout/BlockFormattingContext.h>
+#include <LibWeb/Layout/LayoutTrace.h>
 #include <LibWeb/Layout/TreeBuilder.h>
 #include <LibWeb/Layout/Viewport.h>
 #include <LibWeb/Namespace.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/StackingContext.h>
 #include <LibWeb/Painting/ViewportPaintable.h>
 #include <LibWeb/PermissionsPolicy/AutoplayAllowlist.h>
 #include <LibWeb/ResizeObserver/ResizeObserver.h>
@@ -541,6 +544,8 @@ void Document::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_page);
     visitor.visit(m_window);
     visitor.visit(m_layout_root);
+    if (m_layout_trace)
+        m_layout_trace->visit_edges(visitor);
     visitor.visit(m_style_sheets);
     visitor.visit(m_hovered_node);
     visitor.visit(m_inspected_node);
@@ -590,6 +595,8 @@ void Document::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_shared_resource_requests);
 
     visitor.visit(m_associated_animation_timelines);
+    visitor.visit(m_animated_stacking_context_boxes);
+    visitor.visit(m_layout_boundaries_needing_layout_update);
     visitor.visit(m_list_of_available_images);
 
     for (auto* form_associated_element : m_form_associated_elements_with_form_attribute)
@@ -1311,6 +1318,129 @@ static void propagate_overflow_to_viewport(Element& root_element, Layout::Viewpo
     overflow_origin_computed_values.set_overflow_y(CSS::Overflow::Visible);
 }
 
+// Assign each box that establishes a formatting context a list of absolutely positioned children it should take care of during layout.
+// Returns false if an absolutely positioned box inside `root` has its containing block outside of it.
+static bool assign_contained_abspos_children(Layout::Box& root)
+{
+    bool all_abspos_children_are_contained = true;
+    root.for_each_in_subtree_of_type<Layout::Box>([&](auto& child) {
+        if (!child.is_absolutely_positioned())
+            return TraversalDecision::Continue;
+        if (auto containing_block = child.containing_block()) {
+            if (!root.is_inclusive_ancestor_of(*containing_block)) {
+                all_abspos_children_are_contained = false;
+                return TraversalDecision::Break;
+            }
+            auto closest_box_that_establishes_formatting_context = containing_block;
+            while (closest_box_that_establishes_formatting_context) {
+                if (closest_box_that_establishes_formatting_context.ptr() == &root)
+                    break;
+                if (Layout::FormattingContext::formatting_context_type_created_by_box(*closest_box_that_establishes_formatting_context).has_value()) {
+                    break;
+                }
+                closest_box_that_establishes_formatting_context = closest_box_that_establishes_formatting_context->containing_block();
+            }
+            VERIFY(closest_box_that_establishes_formatting_context);
+            closest_box_that_establishes_formatting_context->add_contained_abspos_child(child);
+        }
+        return TraversalDecision::Continue;
+    });
+    return all_abspos_children_are_contained;
+}
+
+void Document::did_mark_layout_node_for_layout_update(Badge<Layout::Node>, Layout::Node& layout_node)
+{
+    if (m_needs_layout_update_outside_of_layout_boundaries)
+        return;
+
+    auto* layout_boundary = layout_node.nearest_ancestor_layout_boundary();
+    if (!layout_boundary) {
+        m_needs_layout_update_outside_of_layout_boundaries = true;
+        m_layout_boundaries_needing_layout_update.clear();
+        return;
+    }
+    m_layout_boundaries_needing_layout_update.set(*layout_boundary);
+}
+
+// Lays out the inside of each dirty layout boundary on its own, and replaces only the paintables inside of it.
+// Returns false if the whole tree has to be laid out instead.
+bool Document::update_layout_of_dirty_layout_boundaries()
+{
+    if (m_needs_layout_update_outside_of_layout_boundaries || m_layout_boundaries_needing_layout_update.is_empty())
+        return false;
+
+    Vector<GC::Ref<Layout::Box>> layout_boundaries;
+    for (auto const& layout_boundary : m_layout_boundaries_needing_layout_update) {
+        // NOTE: The box was a layout boundary when a node inside it was marked, but that may no longer be the case.
+        if (!m_layout_root->is_ancestor_of(*layout_boundary) || !layout_boundary->is_layout_boundary() || !layout_boundary->paintable_box())
+            return false;
+
+        // A layout boundary inside another dirty one is laid out along with it.
+        bool is_inside_other_layout_boundary = false;
+        for (auto const& other_layout_boundary : m_layout_boundaries_needing_layout_update) {
+            if (other_layout_boundary->is_ancestor_of(*layout_boundary)) {
+                is_inside_other_layout_boundary = true;
+                break;
+            }
+        }
+        if (!is_inside_other_layout_boundary)
+            layout_boundaries.append(layout_boundary);
+    }
+
+    for (auto& layout_boundary : layout_boundaries) {
+        layout_boundary->for_each_in_subtree([&](auto& layout_node) {
+            layout_node.recompute_containing_block({});
+            return TraversalDecision::Continue;
+        });
+
+        layout_boundary->for_each_in_inclusive_subtree_of_type<Layout::Box>([&](auto& child) {
+            child.clear_contained_abspos_children();
+            return TraversalDecision::Continue;
+        });
+
+        if (!assign_contained_abspos_children(*layout_boundary))
+            return false;
+
+        Layout::LayoutState layout_state;
+        if (!layout_state.populate_from_paintables(*layout_boundary))
+            return false;
+
+        auto const& boundary_state = layout_state.get(*layout_boundary);
+        {
+            Layout::BlockFormattingContext formatting_context(layout_state, Layout::LayoutMode::Normal, as<Layout::BlockContainer>(*layout_boundary), nullptr);
+            formatting_context.run(
+                Layout::AvailableSpace(
+                    Layout::AvailableSize::make_definite(boundary_state.content_width()),
+                    Layout::AvailableSize::make_definite(boundary_state.content_height())));
+            formatting_context.parent_context_did_dimension_child_root_box();
+        }
+
+        // The size of a layout boundary doesn't depend on its contents, but let's make sure.
+        auto const& paintable_box = *layout_boundary->paintable_box();
+        if (boundary_state.content_width() != paintable_box.content_width() || boundary_state.content_height() != paintable_box.content_height())
+            return false;
+
+        layout_state.commit_subtree(*layout_boundary);
+    }
+
+    for (auto& layout_boundary : layout_boundaries) {
+        layout_boundary->for_each_in_inclusive_subtree([](auto& node) {
+            node.reset_needs_layout_update();
+            return TraversalDecision::Continue;
+        });
+        for (auto* ancestor = layout_boundary->parent(); ancestor && ancestor->needs_layout_update(); ancestor = ancestor->parent())
+            ancestor->reset_needs_layout_update();
+    }
+
+    // The stacking contexts refer to the paintables that were just replaced.
+    invalidate_stacking_context_tree();
+
+    if constexpr (UPDATE_LAYOUT_DEBUG) {
+        dbgln("RELAYOUT {} layout boundaries", layout_boundaries.size());
+    }
+    return true;
+}
+
 void Document::update_layout(UpdateLayoutReason reason)
 {
     auto navigable = this->navigable();
@@ -1341,8 +1471,19 @@ void Document::update_layout(UpdateLayoutReason reason)
     auto viewport_rect = navigable->viewport_rect();
 
     auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+    Layout::LayoutTraceScope trace_scope { *this, to_string(reason) };
+
+    auto needs_layout_tree_rebuild = !m_layout_root || needs_layout_tree_update() || child_needs_layout_tree_update() || needs_full_layout_tree_update();
+    if (!needs_layout_tree_rebuild && update_layout_of_dirty_layout_boundaries()) {
+        finish_layout_update();
 
-    if (!m_layout_root || needs_layout_tree_update() || child_needs_layout_tree_update() || needs_full_layout_tree_update()) {
+        if constexpr (UPDATE_LAYOUT_DEBUG) {
+            dbgln("LAYOUT {} {} µs, intrinsic size cache: {} hits, {} misses", to_string(reason), timer.elapsed_time().to_microseconds(), m_intrinsic_size_cache_statistics.hits.load(), m_intrinsic_size_cache_statistics.misses.load());
+        }
+        return;
+    }
+
+    if (needs_layout_tree_rebuild) {
         Layout::TreeBuilder tree_builder;
         m_layout_root = as<Layout::Viewport>(*tree_builder.build(*this));
 
@@ -1363,33 +1504,14 @@ void Document::update_layout(UpdateLayoutReason reason)
         return TraversalDecision::Continue;
     });
 
+    // NOTE: Cached intrinsic sizes are invalidated as soon as something they depend on changes, see
+    //       Layout::Node::invalidate_cached_intrinsic_sizes(), so they stay valid across layouts.
     m_layout_root->for_each_in_inclusive_subtree_of_type<Layout::Box>([&](auto& child) {
-        if (child.needs_layout_update()) {
-            child.reset_cached_intrinsic_sizes();
-        }
         child.clear_contained_abspos_children();
         return TraversalDecision::Continue;
     });
 
-    // Assign each box that establishes a formatting context a list of absolutely positioned children it should take care of during layout
-    m_layout_root->for_each_in_inclusive_subtree_of_type<Layout::Box>([&](auto& child) {
-        if (!child.is_absolutely_positioned())
-            return TraversalDecision::Continue;
-        if (auto containing_block = child.containing_block()) {
-            auto closest_box_that_establishes_formatting_context = containing_block;
-            while (closest_box_that_establishes_formatting_context) {
-                if (closest_box_that_establishes_formatting_context == m_layout_root)
-                    break;
-                if (Layout::FormattingContext::formatting_context_type_created_by_box(*closest_box_that_establishes_formatting_context).has_value()) {
-                    break;
-                }
-                closest_box_that_establishes_formatting_context = closest_box_that_establishes_formatting_context->containing_block();
-            }
-            VERIFY(closest_box_that_establishes_formatting_context);
-            closest_box_that_establishes_formatting_context->add_contained_abspos_child(child);
-        }
-        return TraversalDecision::Continue;
-    });
+    assign_contained_abspos_children(*m_layout_root);
 
     Layout::LayoutState layout_state;
 
@@ -1414,6 +1536,37 @@ void Document::update_layout(UpdateLayoutReason reason)
 
     layout_state.commit(*m_layout_root);
 
+    m_layout_root->for_each_in_inclusive_subtree([](auto& node) {
+        node.reset_needs_layout_update();
+        return TraversalDecision::Continue;
+    });
+
+    finish_layout_update();
+
+    if constexpr (UPDATE_LAYOUT_DEBUG) {
+        dbgln("LAYOUT {} {} µs, intrinsic size cache: {} hits, {} misses", to_string(reason), timer.elapsed_time().to_microseconds(), m_intrinsic_size_cache_statistics.hits.load(), m_intrinsic_size_cache_statistics.misses.load());
+    }
+}
+
+void Document::start_layout_trace()
+{
+    m_layout_trace = make<Layout::LayoutTrace>();
+}
+
+String Document::stop_layout_trace()
+{
+    if (!m_layout_trace)
+        return {};
+    auto trace = m_layout_trace->serialize_as_chrome_trace_events();
+    m_layout_trace = nullptr;
+    return trace;
+}
+
+void Document::finish_layout_update()
+{
+    m_layout_boundaries_needing_layout_update.clear();
+    m_needs_layout_update_outside_of_layout_boundaries = false;
+
     // Broadcast the current viewport rect to any new paintables, so they know whether they're visible or not.
     inform_all_viewport_clients_about_the_current_viewport_rect();
 
@@ -1442,19 +1595,10 @@ void Document::update_layout(UpdateLayoutReason reason)
     });
     paintable()->set_paintable_boxes_with_auto_content_visibility(move(paintable_boxes_with_auto_content_visibility));
 
-    m_layout_root->for_each_in_inclusive_subtree([](auto& node) {
-        node.reset_needs_layout_update();
-        return TraversalDecision::Continue;
-    });
-
     // Scrolling by zero offset will clamp scroll offset back to valid range if it was out of bounds
     // after the viewport size change.
     if (auto window = this->window())
         window->scroll_by(0, 0);
-
-    if constexpr (UPDATE_LAYOUT_DEBUG) {
-        dbgln("LAYOUT {} {} µs", to_string(reason), timer.elapsed_time().to_microseconds());
-    }
 }
 
 [[nodiscard]] static CSS::RequiredInvalidationAfterStyleChange update_style_recursively(Node& node, CSS::StyleComputer& style_computer, bool needs_inherited_style_update, bool recompute_elements_depending_on_custom_properties)
@@ -1487,7 +1631,11 @@ void Document::update_layout(UpdateLayoutReason reason)
     if (node_invalidation.rebuild_layout_tree) {
         // We mark layout tree for rebuild starting from parent element to correctly invalidate
         // "display" property change to/from "contents" value.
-        if (auto parent_element = node.parent_element()) {
+        // A node that gets a box for the first time after everything else in its parent (e.g. an item appended to
+        // a feed) can have it built in place instead, which spares rebuilding all of its siblings.
+        if (node.can_append_layout_subtree_to_parent()) {
+            node.set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::StyleChange);
+        } else if (auto parent_element = node.parent_element()) {
             parent_element->set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::StyleChange);
         } else {
             node.set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::StyleChange);
@@ -1557,9 +1705,12 @@ void Document::update_style()
 
     evaluate_media_rules();
 
-    style_computer().reset_ancestor_filter();
+    CSS::StyleComputer::AncestorFilterScope ancestor_filter_scope { style_computer() };
+    style_computer().reset_style_sharing_cache();
 
+    style_computer().set_caching_has_results(true);
     auto invalidation = update_style_recursively(*this, style_computer(), false, false);
+    style_computer().set_caching_has_results(false);
     if (!invalidation.is_none())
         invalidate_display_list();
     if (invalidation.rebuild_stacking_context_tree)
@@ -1779,27 +1930,44 @@ void Document::invalidate_style_of_elements_affected_by_has()
         return;
     }
 
+    // Only the ancestors and siblings that can actually be anchors of the :has() pseudo-classes in use need to be
+    // visited, e.g. for "li:has(> img)" that's just the parent of the element that changed.
+    auto const& reach = style_computer().has_anchor_reach();
+
     auto nodes = move(m_pending_nodes_for_style_invalidation_due_to_presence_of_has);
     for (auto const& node : nodes) {
         if (node.is_null())
             continue;
+        size_t ancestor_distance = 0;
         for (auto* ancestor = node.ptr(); ancestor; ancestor = ancestor->parent_or_shadow_host()) {
             if (!ancestor->is_element())
                 continue;
+            if (ancestor_distance++ > reach.max_ancestor_distance)
+                break;
             auto& element = static_cast<Element&>(*ancestor);
             element.invalidate_style_if_affected_by_has();
 
-            auto* parent = ancestor->parent_or_shadow_host();
-            if (!parent)
-                return;
-
             // If any ancestor's sibling was tested against selectors like ".a:has(+ .b)" or ".a:has(~ .b)"
             // its style might be affected by the change in descendant node.
-            parent->for_each_child_of_type<Element>([&](auto& ancestor_sibling_element) {
-                if (ancestor_sibling_element.affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator())
-                    ancestor_sibling_element.invalidate_style_if_affected_by_has();
-                return IterationDecision::Continue;
-            });
+            switch (reach.siblings) {
+            case CSS::HasAnchorReach::Siblings::None:
+                break;
+            case CSS::HasAnchorReach::Siblings::Preceding:
+                for (auto* sibling = element.previous_element_sibling(); sibling; sibling = sibling->previous_element_sibling()) {
+                    if (sibling->affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator())
+                        sibling->invalidate_style_if_affected_by_has();
+                }
+                break;
+            case CSS::HasAnchorReach::Siblings::All:
+                if (auto* parent = ancestor->parent_or_shadow_host()) {
+                    parent->for_each_child_of_type<Element>([&](auto& ancestor_sibling_element) {
+                        if (ancestor_sibling_element.affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator())
+                            ancestor_sibling_element.invalidate_style_if_affected_by_has();
+                        return IterationDecision::Continue;
+                    });
+                }
+                break;
+            }
         }
     }
 }
@@ -1811,7 +1979,8 @@ void Document::invalidate_style_for_elements_affected_by_pseudo_class_change(CSS
     auto& root = old_new_common_ancestor.root();
     auto shadow_root = is<ShadowRoot>(root) ? static_cast<ShadowRoot const*>(&root) : nullptr;
 
-    auto& style_computer = this->style_computer();
+    // This walk doesn't compute any style, so it keeps an ancestor filter of its own rather than the style computer's.
+    auto ancestor_filter = make<CSS::AncestorFilter>();
     auto does_rule_match_on_element = [&](Element const& element, CSS::MatchingRule const& rule) {
         auto rule_root = rule.shadow_root;
         auto from_user_agent_or_user_stylesheet = rule.cascade_origin == CSS::CascadeOrigin::UserAgent || rule.cascade_origin == CSS::CascadeOrigin::User;
@@ -1821,8 +1990,8 @@ void Document::invalidate_style_for_elements_affected_by_pseudo_class_change(CSS
         if (!rule_is_relevant_for_current_scope)
             return false;
 
-        auto const& selector = rule.selector;
-        if (selector.can_use_ancestor_filter() && style_computer.should_reject_with_ancestor_filter(selector))
+        auto const& selector = *rule.selector;
+        if (selector.can_use_ancestor_filter() && ancestor_filter->should_reject(selector))
             return false;
 
         SelectorEngine::MatchContext context;
@@ -1859,7 +2028,7 @@ void Document::invalidate_style_for_elements_affected_by_pseudo_class_change(CSS
     Function<void(Node&)> invalidate_affected_elements_recursively = [&](Node& node) -> void {
         if (node.is_element()) {
             auto& element = static_cast<Element&>(node);
-            style_computer.push_ancestor(element);
+            ancestor_filter->push(element);
             if (element.affected_by_pseudo_class(pseudo_class) && matches_different_set_of_rules_after_state_change(element)) {
                 element.set_needs_style_update(true);
             }
@@ -1871,7 +2040,7 @@ void Document::invalidate_style_for_elements_affected_by_pseudo_class_change(CSS
         });
 
         if (node.is_element())
-            style_computer.pop_ancestor(static_cast<Element&>(node));
+            ancestor_filter->pop(static_cast<Element&>(node));
     };
 
     invalidate_affected_elements_recursively(root);
@@ -6437,6 +6606,7 @@ void Document::set_needs_display(CSSPixelRect const&, InvalidateDisplayList shou
 void Document::invalidate_display_list()
 {
     m_cached_display_list.clear();
+    m_animated_stacking_context_boxes.clear();
 
     auto navigable = this->navigable();
     if (!navigable)
@@ -6452,11 +6622,53 @@ RefPtr<Painting::DisplayList> Document::cached_display_list() const
     return m_cached_display_list;
 }
 
-RefPtr<Painting::DisplayList> Document::record_display_list(HTML::PaintConfig config)
+void Document::did_animate_stacking_context(Painting::PaintableBox& paintable_box)
+{
+    // NOTE: Replaying only works if the stacking context was recorded into the cached display list. It isn't if the
+    //       display list is already invalidated, or if the stacking context was skipped for being fully transparent.
+    if (!m_cached_display_list || !m_cached_display_list->stacking_context_command_index(paintable_box).has_value()) {
+        set_needs_display();
+        return;
+    }
+
+    m_animated_stacking_context_boxes.set(paintable_box);
+    set_needs_to_resolve_paint_only_properties();
+    set_needs_display(InvalidateDisplayList::No);
+}
+
+HashMap<size_t, Painting::AnimatedStackingContextProperties> Document::animated_stacking_context_properties()
+{
+    HashMap<size_t, Painting::AnimatedStackingContextProperties> properties_by_command_index;
+    if (!m_cached_display_list || m_animated_stacking_context_boxes.is_empty())
+        return properties_by_command_index;
+
+    // The transform of each box is resolved along with its other paint-only properties.
+    update_paint_and_hit_testing_properties_if_needed();
+
+    for (auto paintable_box : m_animated_stacking_context_boxes) {
+        auto const* stacking_context = paintable_box->stacking_context();
+        auto command_index = m_cached_display_list->stacking_context_command_index(paintable_box);
+        if (!stacking_context || !command_index.has_value())
+            continue;
+        properties_by_command_index.set(*command_index, stacking_context->animated_properties(m_cached_display_list->device_pixels_per_css_pixel()));
+    }
+    return properties_by_command_index;
+}
+
+RefPtr<Painting::DisplayList> Document::record_display_list(HTML::PaintConfig config, ReplayAnimatedStackingContexts replay_animated_stacking_contexts)
 {
     if (m_cached_display_list && m_cached_display_list_paint_config == config) {
-        return m_cached_display_list;
+        if (m_animated_stacking_context_boxes.is_empty())
+            return m_cached_display_list;
+        if (replay_animated_stacking_contexts == ReplayAnimatedStackingContexts::Yes) {
+            ++m_display_list_statistics.replays_with_animated_stacking_contexts;
+            return m_cached_display_list;
+        }
+        // NOTE: Containing documents may have embedded the outdated display list, so they have to record again too.
+        invalidate_display_list();
     }
+    m_animated_stacking_context_boxes.clear();
+    ++m_display_list_statistics.recordings;
 
     auto display_list = Painting::DisplayList::create(page().client().device_pixels_per_css_pixel());
     Painting::DisplayListRecorder display_list_recorder(display_list);
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/Function.h>
 #include <AK/HashMap.h>
 #include <AK/OwnPtr.h>
@@ -156,6 +157,22 @@ struct ElementCreationOptions {
     Optional<String> is;
 };
 
+// NOTE: These are atomic because boxes can be laid out on the layout thread pool (see Layout/ParallelLayout.h).
+struct IntrinsicSizeCacheStatistics {
+    Atomic<u64, AK::MemoryOrder::memory_order_relaxed> hits { 0 };
+    Atomic<u64, AK::MemoryOrder::memory_order_relaxed> misses { 0 };
+    // Number of boxes whose cached intrinsic sizes were thrown away because something they depend on changed.
+    Atomic<u64, AK::MemoryOrder::memory_order_relaxed> invalidations { 0 };
+};
+
+struct DisplayListStatistics {
+    // Number of display lists recorded for the document.
+    u64 recordings { 0 };
+    // Number of times the cached display list was handed out for replay with new opacity or transform values of
+    // animated stacking contexts, instead of being recorded again.
+    u64 replays_with_animated_stacking_contexts { 0 };
+};
+
 enum class PolicyControlledFeature : u8 {
     Autoplay,
     FocusWithoutUserActivation,
@@ -339,6 +356,17 @@ public:
 
     void update_style();
     void update_layout(UpdateLayoutReason);
+    void did_mark_layout_node_for_layout_update(Badge<Layout::Node>, Layout::Node&);
+
+    IntrinsicSizeCacheStatistics& intrinsic_size_cache_statistics() { return m_intrinsic_size_cache_statistics; }
+    IntrinsicSizeCacheStatistics const& intrinsic_size_cache_statistics() const { return m_intrinsic_size_cache_statistics; }
+
+    // While a layout trace is being recorded, layouts of this document record their formatting context runs and
+    // intrinsic size computations into it. Stopping the trace returns it in the Chrome trace event format.
+    void start_layout_trace();
+    String stop_layout_trace();
+    Layout::LayoutTrace* layout_trace() const { return m_layout_trace.ptr(); }
+
     void update_paint_and_hit_testing_properties_if_needed();
     void update_animated_style_if_needed();
 
@@ -836,10 +864,24 @@ public:
     void set_needs_display(CSSPixelRect const&, InvalidateDisplayList = InvalidateDisplayList::Yes);
 
     RefPtr<Painting::DisplayList> cached_display_list() const;
-    RefPtr<Painting::DisplayList> record_display_list(HTML::PaintConfig);
+
+    // Whether the caller passes animated_stacking_context_properties() to the player along with the display list.
+    // If it doesn't, a cached display list with outdated opacity or transform values is recorded again.
+    enum class ReplayAnimatedStackingContexts {
+        No,
+        Yes,
+    };
+    RefPtr<Painting::DisplayList> record_display_list(HTML::PaintConfig, ReplayAnimatedStackingContexts = ReplayAnimatedStackingContexts::No);
+    DisplayListStatistics const& display_list_statistics() const { return m_display_list_statistics; }
 
     void invalidate_display_list();
 
+    // Called when an animation only changed the opacity or transform of the stacking context established by the
+    // given box. As long as nothing else changes, the cached display list is replayed with the new values instead
+    // of being recorded again.
+    void did_animate_stacking_context(Painting::PaintableBox&);
+    HashMap<size_t, Painting::AnimatedStackingContextProperties> animated_stacking_context_properties();
+
     Unicode::Segmenter& grapheme_segmenter() const;
     Unicode::Segmenter& word_segmenter() const;
 
@@ -932,6 +974,9 @@ private:
 
     void tear_down_layout_tree();
 
+    bool update_layout_of_dirty_layout_boundaries();
+    void finish_layout_update();
+
     void update_active_element();
 
     void run_unloading_cleanup_steps();
@@ -1084,6 +1129,14 @@ private:
     bool m_needs_full_style_update { false };
     bool m_needs_full_layout_tree_update { false };
 
+    // The layout boundaries containing every layout node that was marked for layout update since the last layout.
+    // If any marked node isn't inside a layout boundary, the whole tree has to be laid out instead.
+    HashTable<GC::Ref<Layout::Box>> m_layout_boundaries_needing_layout_update;
+    bool m_needs_layout_update_outside_of_layout_boundaries { false };
+
+    IntrinsicSizeCacheStatistics m_intrinsic_size_cache_statistics;
+    OwnPtr<Layout::LayoutTrace> m_layout_trace;
+
     bool m_needs_animated_style_update { false };
 
     HashTable<GC::Ptr<NodeIterator>> m_node_iterators;
@@ -1249,6 +1302,8 @@ private:
 
     Optional<HTML::PaintConfig> m_cached_display_list_paint_config;
     RefPtr<Painting::DisplayList> m_cached_display_list;
+    HashTable<GC::Ref<Painting::PaintableBox>> m_animated_stacking_context_boxes;
+    DisplayListStatistics m_display_list_statistics;
 
     mutable OwnPtr<Unicode::Segmenter> m_grapheme_segmenter;
     mutable OwnPtr<Unicode::Segmenter> m_word_segmenter;
@@ -279,6 +279,9 @@ public:
 
     virtual GC::Ptr<Layout::Node> create_layout_node(GC::Ref<CSS::ComputedProperties>);
     virtual void adjust_computed_style(CSS::ComputedProperties&) { }
+    // Elements whose adjust_computed_style() looks at internal state beyond their attributes must opt out of
+    // sharing their computed style with identical-looking siblings.
+    virtual bool can_share_computed_style_with_siblings() const { return true; }
 
     virtual void did_receive_focus() { }
     virtual void did_lose_focus() { }
@@ -436,6 +439,10 @@ public:
     // https://drafts.csswg.org/css-contain-2/#skips-its-contents
     bool skips_its_contents();
 
+    // https://drafts.csswg.org/css-sizing-4/#last-remembered
+    Optional<CSSPixelSize> last_remembered_size() const { return m_last_remembered_size; }
+    void set_last_remembered_size(Optional<CSSPixelSize> size) { m_last_remembered_size = size; }
+
     bool matches_enabled_pseudo_class() const;
     bool matches_disabled_pseudo_class() const;
     bool matches_checked_pseudo_class() const;
@@ -643,6 +650,9 @@ private:
     // https://drafts.csswg.org/css-contain/#proximity-to-the-viewport
     ProximityToTheViewport m_proximity_to_the_viewport { ProximityToTheViewport::NotDetermined };
 
+    // https://drafts.csswg.org/css-sizing-4/#last-remembered
+    Optional<CSSPixelSize> m_last_remembered_size;
+
     // https://html.spec.whatwg.org/multipage/grouping-content.html#ordinal-value
     Optional<i32> m_ordinal_value;
     bool m_is_contained_in_list_subtree { false };
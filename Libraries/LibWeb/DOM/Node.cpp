@@ -8,6 +8,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AllOf.h>
 #include <AK/HashTable.h>
 #include <AK/StringBuilder.h>
 #include <LibGC/DeferGC.h>
@@ -55,6 +56,7 @@
 #include <LibWeb/HTML/Parser/HTMLParser.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/Infra/CharacterTypes.h>
+#include <LibWeb/Layout/Box.h>
 #include <LibWeb/Layout/Node.h>
 #include <LibWeb/Layout/TextNode.h>
 #include <LibWeb/MathML/MathMLElement.h>
@@ -789,7 +791,18 @@ void Node::insert_before(GC::Ref<Node> node, GC::Ptr<Node> child, bool suppress_
         if (layout_node() && layout_node()->display().is_contents() && parent_element()) {
             parent_element()->set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::NodeInsertBeforeWithDisplayContents);
         }
-        set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::NodeInsertBefore);
+
+        // Nodes appended after all of our other children can have their layout subtrees built in place, instead of
+        // rebuilding the layout subtree of every existing child along with ours.
+        bool can_append_layout_subtrees = !child && all_of(nodes, [](auto const& node) {
+            return !node->needs_layout_tree_update() && node->can_append_layout_subtree_to_parent();
+        });
+        if (can_append_layout_subtrees) {
+            for (auto& node : nodes)
+                node->set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::NodeInsertBefore);
+        } else {
+            set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::NodeInsertBefore);
+        }
     }
 
     // AD-HOC: invalidate the ordinal of the first list_item of the list_owner of the child node, if any.
@@ -1672,8 +1685,59 @@ void Node::set_needs_layout_tree_update(bool value, SetNeedsLayoutTreeUpdateReas
                 if (ancestor)
                     ancestor->dom_node()->set_needs_layout_tree_update(true, reason);
             }
+        } else if (auto* parent = parent_element(); parent && parent->layout_node()) {
+            // We don't have a box yet, but will get one inside our parent's (see can_append_layout_subtree_to_parent()).
+            parent->layout_node()->set_needs_layout_update(SetNeedsLayoutReason::LayoutTreeUpdate);
+        }
+    }
+}
+
+bool Node::can_append_layout_subtree_to_parent() const
+{
+    if (layout_node() || !is_connected())
+        return false;
+
+    if (auto const* element = as_if<Element>(*this)) {
+        if (element->rendered_in_top_layer())
+            return false;
+        // Without computed style (i.e. while being inserted) we can't tell yet; style update will ask again.
+        if (auto style = element->computed_properties()) {
+            auto display = style->display();
+            if (display.is_contents() || display.is_internal())
+                return false;
         }
     }
+
+    // Our children must end up as the children of our parent's box, in a container that never needs to be split into
+    // continuations or wrapped into table parts.
+    auto const* parent_element = as_if<Element>(parent());
+    if (!parent_element || parent_element->is_shadow_host() || is<HTML::HTMLSlotElement>(*parent_element))
+        return false;
+    if (auto const* html_element = as_if<HTML::HTMLElement>(*parent_element); html_element && html_element->uses_button_layout())
+        return false;
+
+    auto const* parent_box = as_if<Layout::Box>(parent_element->layout_node());
+    if (!parent_box || !parent_box->can_have_children())
+        return false;
+    if (parent_box->contents_are_skipped())
+        return false;
+    auto parent_display = parent_box->display();
+    if (!parent_display.is_flow_inside() && !parent_display.is_flow_root_inside() && !parent_display.is_flex_inside() && !parent_display.is_grid_inside())
+        return false;
+    if (parent_display.is_inline_outside() && parent_display.is_flow_inside())
+        return false;
+
+    // Appending is only correct if nothing is laid out after us within our parent.
+    if (parent_element->get_pseudo_element_node(CSS::PseudoElement::After))
+        return false;
+    for (auto const* sibling = next_sibling(); sibling; sibling = sibling->next_sibling()) {
+        if (sibling->layout_node())
+            return false;
+        if (auto const* element = as_if<Element>(*sibling); element && element->computed_properties() && element->computed_properties()->display().is_contents())
+            return false;
+    }
+
+    return true;
 }
 
 void Node::set_needs_style_update(bool value)
@@ -117,10 +117,12 @@ enum class SetNeedsLayoutReason {
 
 #define ENUMERATE_SET_NEEDS_LAYOUT_TREE_UPDATE_REASONS(X) \
     X(ElementSetInnerHTML)                                \
+    X(ContentVisibilityAutoRelevanceChange)               \
     X(DetailsElementOpenedOrClosed)                       \
     X(HTMLInputElementSrcAttribute)                       \
     X(HTMLOListElementOrdinalValues)                      \
     X(HTMLObjectElementUpdateLayoutAndChildObjects)       \
+    X(HTMLTableCellElementSpanAttribute)                  \
     X(KeyframeEffect)                                     \
     X(NodeInsertBefore)                                   \
     X(NodeInsertBeforeWithDisplayContents)                \
@@ -351,6 +353,10 @@ public:
     [[nodiscard]] bool needs_layout_tree_update() const { return m_needs_layout_tree_update; }
     void set_needs_layout_tree_update(bool, SetNeedsLayoutTreeUpdateReason);
 
+    // Whether the layout subtree for this node, which doesn't have a layout node yet, can be built and appended to its
+    // parent's box without rebuilding the layout subtrees of its siblings.
+    [[nodiscard]] bool can_append_layout_subtree_to_parent() const;
+
     [[nodiscard]] bool child_needs_layout_tree_update() const { return m_child_needs_layout_tree_update; }
     void set_child_needs_layout_tree_update(bool b) { m_child_needs_layout_tree_update = b; }
 
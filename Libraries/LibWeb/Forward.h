@@ -35,6 +35,7 @@ AK_TYPEDEF_DISTINCT_NUMERIC_GENERAL(i64, UniqueNodeID, Comparison, Increment, Ca
 
 namespace Web::Painting {
 
+struct AnimatedStackingContextProperties;
 class BackingStore;
 class DevicePixelConverter;
 class DisplayList;
@@ -45,6 +46,7 @@ class ScrollStateSnapshot;
 using PaintStyle = RefPtr<SVGGradientPaintStyle>;
 using PaintStyleOrColor = Variant<PaintStyle, Gfx::Color>;
 using ScrollStateSnapshotByDisplayList = HashMap<NonnullRefPtr<DisplayList>, ScrollStateSnapshot>;
+using AnimatedStackingContextsByDisplayList = HashMap<NonnullRefPtr<DisplayList>, HashMap<size_t, AnimatedStackingContextProperties>>;
 
 }
 
@@ -206,6 +208,7 @@ class SubtleCrypto;
 namespace Web::CSS {
 
 class AbstractImageStyleValue;
+class AncestorFilter;
 class AnchorStyleValue;
 class AnchorSizeStyleValue;
 class Angle;
@@ -814,6 +817,7 @@ class InlineFormattingContext;
 class InlineNode;
 class Label;
 class LabelableNode;
+class LayoutTrace;
 class LegendBox;
 class LineBox;
 class LineBoxFragment;
@@ -22,6 +22,7 @@
 #include <LibWeb/HighResolutionTime/Performance.h>
 #include <LibWeb/HighResolutionTime/TimeOrigin.h>
 #include <LibWeb/IndexedDB/Internal/Algorithms.h>
+#include <LibWeb/Layout/Box.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/PaintableBox.h>
 #include <LibWeb/Painting/ViewportPaintable.h>
@@ -400,6 +401,10 @@ void EventLoop::update_the_rendering()
         // 1. Let resizeObserverDepth be 0.
         size_t resize_observer_depth = 0;
 
+        // NOTE: Only lay out the document again once per rendering update for elements that start rendering their
+        //       contents, so that elements whose relevance depends on their own size can't keep us here forever.
+        bool did_update_layout_for_content_visibility_auto_changes = false;
+
         // 2. While true:
         while (true) {
             // 1. Recalculate styles and update layout for doc.
@@ -409,11 +414,21 @@ void EventLoop::update_the_rendering()
             // 2. Let hadInitialVisibleContentVisibilityDetermination be false.
             bool had_initial_visible_content_visibility_determination = false;
 
+            // NOTE: Set if an element that skipped its contents became relevant to the user, and needs its contents laid out.
+            bool has_content_visibility_auto_element_to_lay_out = false;
+
             // 3. For each element element with 'auto' used value of 'content-visibility':
             auto* document_element = document->document_element();
             if (document_element) {
                 for (auto& paintable_box : document->paintable()->paintable_boxes_with_auto_content_visibility()) {
                     auto& element = as<DOM::Element>(*paintable_box->dom_node());
+                    auto const* box = as_if<Layout::Box>(paintable_box->layout_node());
+
+                    // https://drafts.csswg.org/css-sizing-4/#last-remembered
+                    // NOTE: This is done here rather than when resize observations are gathered, so that the size is
+                    //       recorded before the element possibly starts skipping its contents below.
+                    if (box && !box->contents_are_skipped())
+                        element.set_last_remembered_size(paintable_box->content_size());
 
                     // 1. Let checkForInitialDetermination be true if element's proximity to the viewport is not determined and it is not relevant to the user. Otherwise, let checkForInitialDetermination be false.
                     bool check_for_initial_determination = element.proximity_to_the_viewport() == Web::DOM::ProximityToTheViewport::NotDetermined && !element.is_relevant_to_the_user();
@@ -425,6 +440,16 @@ void EventLoop::update_the_rendering()
                     if (check_for_initial_determination && element.is_relevant_to_the_user()) {
                         had_initial_visible_content_visibility_determination = true;
                     }
+
+                    // NOTE: An element that skips its contents is built without them, so rebuild its layout subtree
+                    //       whenever it starts or stops skipping them.
+                    if (box && box->contents_are_skipped() != element.skips_its_contents()) {
+                        element.set_needs_layout_tree_update(true, DOM::SetNeedsLayoutTreeUpdateReason::ContentVisibilityAutoRelevanceChange);
+                        if (box->contents_are_skipped())
+                            has_content_visibility_auto_element_to_lay_out = true;
+                        else
+                            document->set_needs_display();
+                    }
                 }
             }
 
@@ -432,6 +457,11 @@ void EventLoop::update_the_rendering()
             if (had_initial_visible_content_visibility_determination)
                 continue;
 
+            if (has_content_visibility_auto_element_to_lay_out && !did_update_layout_for_content_visibility_auto_changes) {
+                did_update_layout_for_content_visibility_auto_changes = true;
+                continue;
+            }
+
             // 5. Gather active resize observations at depth resizeObserverDepth for doc.
             document->gather_active_observations_at_depth(resize_observer_depth);
 
@@ -27,6 +27,7 @@ private:
 
     virtual GC::Ptr<Layout::Node> create_layout_node(GC::Ref<CSS::ComputedProperties>) override;
     virtual void adjust_computed_style(CSS::ComputedProperties&) override;
+    virtual bool can_share_computed_style_with_siblings() const override { return false; }
 
     virtual void on_playing() override;
     virtual void on_paused() override;
@@ -19,6 +19,7 @@ public:
 
     virtual GC::Ptr<Layout::Node> create_layout_node(GC::Ref<CSS::ComputedProperties>) override;
     virtual void adjust_computed_style(CSS::ComputedProperties&) override;
+    virtual bool can_share_computed_style_with_siblings() const override { return false; }
 
 private:
     virtual bool is_html_br_element() const override { return true; }
@@ -25,6 +25,7 @@ private:
     virtual bool is_presentational_hint(FlyString const&) const override;
     virtual void apply_presentational_hints(GC::Ref<CSS::CascadedProperties>) const override;
     virtual void adjust_computed_style(CSS::ComputedProperties&) override;
+    virtual bool can_share_computed_style_with_siblings() const override { return false; }
 };
 
 }
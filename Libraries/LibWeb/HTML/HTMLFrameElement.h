@@ -29,6 +29,7 @@ private:
     virtual void attribute_changed(FlyString const& name, Optional<String> const& old_value, Optional<String> const& value, Optional<FlyString> const& namespace_) override;
     virtual i32 default_tab_index_value() const override;
     virtual void adjust_computed_style(CSS::ComputedProperties&) override;
+    virtual bool can_share_computed_style_with_siblings() const override { return false; }
 
     void process_the_frame_attributes(InitialInsertion = InitialInsertion::No);
 };
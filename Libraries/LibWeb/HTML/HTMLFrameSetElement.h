@@ -27,6 +27,7 @@ private:
     virtual bool is_html_frameset_element() const override { return true; }
 
     virtual void adjust_computed_style(CSS::ComputedProperties&) override;
+    virtual bool can_share_computed_style_with_siblings() const override { return false; }
 
     virtual void initialize(JS::Realm&) override;
     virtual void attribute_changed(FlyString const& name, Optional<String> const& old_value, Optional<String> const& value, Optional<FlyString> const& namespace_) override;
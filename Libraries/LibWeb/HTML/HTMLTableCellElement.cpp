@@ -37,6 +37,20 @@ void HTMLTableCellElement::initialize(JS::Realm& realm)
     Base::initialize(realm);
 }
 
+void HTMLTableCellElement::attribute_changed(FlyString const& name, Optional<String> const& old_value, Optional<String> const& value, Optional<FlyString> const& namespace_)
+{
+    Base::attribute_changed(name, old_value, value, namespace_);
+
+    // The spans of the cells determine the shape of the table grid, and with it the anonymous cells that are generated
+    // for its empty slots, so the layout tree of the whole table has to be rebuilt.
+    if (name == HTML::AttributeNames::colspan || name == HTML::AttributeNames::rowspan) {
+        DOM::Node* table_or_cell = first_ancestor_of_type<HTMLTableElement>();
+        if (!table_or_cell)
+            table_or_cell = this;
+        table_or_cell->set_needs_layout_tree_update(true, DOM::SetNeedsLayoutTreeUpdateReason::HTMLTableCellElementSpanAttribute);
+    }
+}
+
 bool HTMLTableCellElement::is_presentational_hint(FlyString const& name) const
 {
     if (Base::is_presentational_hint(name))
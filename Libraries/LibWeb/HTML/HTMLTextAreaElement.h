@@ -32,6 +32,7 @@ public:
     virtual ~HTMLTextAreaElement() override;
 
     virtual void adjust_computed_style(CSS::ComputedProperties&) override;
+    virtual bool can_share_computed_style_with_siblings() const override { return false; }
 
     String const& type() const
     {
@@ -2658,7 +2658,7 @@ void Navigable::start_display_list_rendering(Gfx::PaintingSurface& painting_surf
         callback();
         return;
     }
-    auto display_list = document->record_display_list(paint_config);
+    auto display_list = document->record_display_list(paint_config, DOM::Document::ReplayAnimatedStackingContexts::Yes);
     if (!display_list) {
         callback();
         return;
@@ -2666,11 +2666,14 @@ void Navigable::start_display_list_rendering(Gfx::PaintingSurface& painting_surf
 
     auto& document_paintable = *document->paintable();
     Painting::ScrollStateSnapshotByDisplayList scroll_state_snapshot_by_display_list;
+    Painting::AnimatedStackingContextsByDisplayList animated_stacking_contexts_by_display_list;
     document_paintable.refresh_scroll_state();
     auto scroll_state_snapshot = document_paintable.scroll_state().snapshot();
     scroll_state_snapshot_by_display_list.set(*display_list, move(scroll_state_snapshot));
-    // Collect scroll state snapshots for each nested navigable
-    document_paintable.for_each_in_inclusive_subtree_of_type<Painting::NavigableContainerViewportPaintable>([&scroll_state_snapshot_by_display_list](auto& navigable_container_paintable) {
+    if (auto animated_stacking_contexts = document->animated_stacking_context_properties(); !animated_stacking_contexts.is_empty())
+        animated_stacking_contexts_by_display_list.set(*display_list, move(animated_stacking_contexts));
+    // Collect scroll state snapshots and animated stacking contexts for each nested navigable
+    document_paintable.for_each_in_inclusive_subtree_of_type<Painting::NavigableContainerViewportPaintable>([&](auto& navigable_container_paintable) {
         auto const* hosted_document = navigable_container_paintable.layout_box().dom_node().content_document_without_origin_check();
         if (!hosted_document || !hosted_document->paintable())
             return TraversalDecision::Continue;
@@ -2683,10 +2686,12 @@ void Navigable::start_display_list_rendering(Gfx::PaintingSurface& painting_surf
         const_cast<DOM::Document&>(*hosted_document).paintable()->refresh_scroll_state();
         auto navigable_scroll_state_snapshot = hosted_document->paintable()->scroll_state().snapshot();
         scroll_state_snapshot_by_display_list.set(*navigable_display_list, move(navigable_scroll_state_snapshot));
+        if (auto animated_stacking_contexts = const_cast<DOM::Document&>(*hosted_document).animated_stacking_context_properties(); !animated_stacking_contexts.is_empty())
+            animated_stacking_contexts_by_display_list.set(*navigable_display_list, move(animated_stacking_contexts));
         return TraversalDecision::Continue;
     });
 
-    m_rendering_thread.enqueue_rendering_task(*display_list, move(scroll_state_snapshot_by_display_list), painting_surface, move(callback));
+    m_rendering_thread.enqueue_rendering_task(*display_list, move(scroll_state_snapshot_by_display_list), move(animated_stacking_contexts_by_display_list), painting_surface, move(callback));
 }
 
 RefPtr<Gfx::SkiaBackendContext> Navigable::skia_backend_context() const
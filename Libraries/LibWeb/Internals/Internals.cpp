@@ -19,6 +19,7 @@
 #include <LibWeb/HTML/HTMLElement.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/Internals/Internals.h>
+#include <LibWeb/Layout/ParallelLayout.h>
 #include <LibWeb/Page/InputEvent.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/PaintableBox.h>
@@ -325,6 +326,49 @@ String Internals::dump_display_list()
     return window().associated_document().dump_display_list();
 }
 
+JS::Object* Internals::get_intrinsic_size_cache_statistics()
+{
+    auto const& statistics = window().associated_document().intrinsic_size_cache_statistics();
+    auto result = JS::Object::create(realm(), nullptr);
+    result->define_direct_property("hits"_utf16_fly_string, JS::Value(static_cast<double>(statistics.hits.load())), JS::default_attributes);
+    result->define_direct_property("misses"_utf16_fly_string, JS::Value(static_cast<double>(statistics.misses.load())), JS::default_attributes);
+    result->define_direct_property("invalidations"_utf16_fly_string, JS::Value(static_cast<double>(statistics.invalidations.load())), JS::default_attributes);
+    return result;
+}
+
+JS::Object* Internals::get_display_list_statistics()
+{
+    auto const& statistics = window().associated_document().display_list_statistics();
+    auto result = JS::Object::create(realm(), nullptr);
+    result->define_direct_property("recordings"_utf16_fly_string, JS::Value(static_cast<double>(statistics.recordings)), JS::default_attributes);
+    result->define_direct_property("replaysWithAnimatedStackingContexts"_utf16_fly_string, JS::Value(static_cast<double>(statistics.replays_with_animated_stacking_contexts)), JS::default_attributes);
+    return result;
+}
+
+void Internals::set_parallel_layout_enabled(bool enabled)
+{
+    Layout::g_parallel_layout_enabled = enabled;
+}
+
+JS::Object* Internals::get_parallel_layout_statistics()
+{
+    auto const& statistics = Layout::parallel_layout_statistics();
+    auto result = JS::Object::create(realm(), nullptr);
+    result->define_direct_property("batches"_utf16_fly_string, JS::Value(static_cast<double>(statistics.batches)), JS::default_attributes);
+    result->define_direct_property("tasks"_utf16_fly_string, JS::Value(static_cast<double>(statistics.tasks)), JS::default_attributes);
+    return result;
+}
+
+void Internals::start_layout_trace()
+{
+    window().associated_document().start_layout_trace();
+}
+
+String Internals::stop_layout_trace()
+{
+    return window().associated_document().stop_layout_trace();
+}
+
 GC::Ptr<DOM::ShadowRoot> Internals::get_shadow_root(GC::Ref<DOM::Element> element)
 {
     return element->shadow_root();
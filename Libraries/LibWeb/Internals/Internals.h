@@ -65,6 +65,14 @@ public:
     bool headless();
 
     String dump_display_list();
+    JS::Object* get_intrinsic_size_cache_statistics();
+    JS::Object* get_display_list_statistics();
+
+    void set_parallel_layout_enabled(bool);
+    JS::Object* get_parallel_layout_statistics();
+
+    void start_layout_trace();
+    String stop_layout_trace();
 
     GC::Ptr<DOM::ShadowRoot> get_shadow_root(GC::Ref<DOM::Element>);
 
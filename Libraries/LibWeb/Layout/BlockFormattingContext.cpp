@@ -15,6 +15,7 @@
 #include <LibWeb/Layout/Box.h>
 #include <LibWeb/Layout/FieldSetBox.h>
 #include <LibWeb/Layout/InlineFormattingContext.h>
+#include <LibWeb/Layout/LayoutTrace.h>
 #include <LibWeb/Layout/LegendBox.h>
 #include <LibWeb/Layout/LineBuilder.h>
 #include <LibWeb/Layout/ListItemBox.h>
@@ -71,6 +72,8 @@ static bool margins_collapse_through(Box const& box, LayoutState& state)
 
 void BlockFormattingContext::run(AvailableSpace const& available_space)
 {
+    LayoutTraceScope trace_scope { *this };
+
     if (is<Viewport>(root())) {
         layout_viewport(available_space);
         return;
@@ -624,6 +627,11 @@ void BlockFormattingContext::layout_inline_children(BlockContainer const& block_
 
 CSSPixels BlockFormattingContext::compute_auto_height_for_block_level_element(Box const& box, AvailableSpace const& available_space)
 {
+    // NOTE: A box whose contents are skipped has no children to size it. Its formatting context reports its explicit
+    //       intrinsic size (from contain-intrinsic-size) instead.
+    if (box.contents_are_skipped() && formatting_context_type_created_by_box(box).has_value())
+        return calculate_max_content_height(box, available_space.width.to_px_or_zero());
+
     if (creates_block_formatting_context(box)) {
         return compute_auto_height_for_block_formatting_context_root(box);
     }
@@ -10,6 +10,7 @@
 #include <LibWeb/Layout/BlockContainer.h>
 #include <LibWeb/Layout/Box.h>
 #include <LibWeb/Layout/FormattingContext.h>
+#include <LibWeb/Layout/TableGrid.h>
 #include <LibWeb/Layout/TableWrapper.h>
 #include <LibWeb/Painting/PaintableBox.h>
 
@@ -57,10 +58,60 @@ Optional<CSSPixelFraction> Box::natural_aspect_ratio() const
     return m_natural_aspect_ratio;
 }
 
+bool Box::is_layout_boundary() const
+{
+    if (is_viewport() || is_anonymous() || generated_for_pseudo_element().has_value())
+        return false;
+
+    // Its size must not depend on its contents.
+    auto const& computed_values = this->computed_values();
+    if (!computed_values.width().is_length() || !computed_values.height().is_length())
+        return false;
+    if (!(computed_values.min_width().is_auto() || computed_values.min_width().is_length()) || !(computed_values.min_height().is_auto() || computed_values.min_height().is_length()))
+        return false;
+    if (!(computed_values.max_width().is_none() || computed_values.max_width().is_length()) || !(computed_values.max_height().is_none() || computed_values.max_height().is_length()))
+        return false;
+
+    // Its contents must not contribute to the scrollable overflow of its ancestors.
+    if (computed_values.overflow_x() == CSS::Overflow::Visible || computed_values.overflow_y() == CSS::Overflow::Visible)
+        return false;
+
+    // Its position must not depend on its contents. Floats and inline-level boxes are placed based on their size and
+    // baseline, and flex and grid items may be sized by their contents even when they have a preferred size.
+    if (!is_absolutely_positioned()) {
+        if (is_floating() || !display().is_block_outside())
+            return false;
+        auto const* parent = this->parent();
+        if (!parent || !is<BlockContainer>(*parent) || parent->children_are_inline())
+            return false;
+        if (!parent->display().is_flow_inside() && !parent->display().is_flow_root_inside())
+            return false;
+    }
+
+    // It must lay out its contents in a block formatting context of its own.
+    return FormattingContext::formatting_context_type_created_by_box(*this) == FormattingContext::Type::Block;
+}
+
+void Box::set_cached_table_grid(NonnullOwnPtr<CachedTableGrid> table_grid) const
+{
+    m_cached_table_grid = move(table_grid);
+}
+
+void Box::reset_cached_table_grid() const
+{
+    m_cached_table_grid.clear();
+}
+
 void Box::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_contained_abspos_children);
+    if (m_cached_table_grid) {
+        for (auto const& cell : m_cached_table_grid->cells)
+            visitor.visit(cell.box);
+        for (auto const& row : m_cached_table_grid->rows)
+            visitor.visit(row.box);
+    }
 }
 
 GC::Ptr<Painting::Paintable> Box::create_paintable() const
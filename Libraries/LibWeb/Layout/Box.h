@@ -12,6 +12,8 @@
 
 namespace Web::Layout {
 
+struct CachedTableGrid;
+
 struct LineBoxFragmentCoordinate {
     size_t line_box_index { 0 };
     size_t fragment_index { 0 };
@@ -66,7 +68,30 @@ public:
             m_cached_intrinsic_sizes = make<IntrinsicSizes>();
         return *m_cached_intrinsic_sizes;
     }
-    void reset_cached_intrinsic_sizes() const { m_cached_intrinsic_sizes.clear(); }
+    // Returns whether there was anything cached.
+    bool reset_cached_intrinsic_sizes() const
+    {
+        if (!m_cached_intrinsic_sizes)
+            return false;
+        m_cached_intrinsic_sizes.clear();
+        return true;
+    }
+
+    // Set on table boxes by TableFormattingContext. Like the cached intrinsic sizes, it's dropped whenever something in
+    // the box's layout subtree changes, see Node::invalidate_cached_intrinsic_sizes().
+    CachedTableGrid const* cached_table_grid() const { return m_cached_table_grid.ptr(); }
+    void set_cached_table_grid(NonnullOwnPtr<CachedTableGrid>) const;
+    void reset_cached_table_grid() const;
+
+    // A layout boundary is a box whose size and position can't be affected by its contents, and whose contents can't
+    // affect anything outside of it. Changes inside a layout boundary can be laid out without touching the rest of the tree.
+    bool is_layout_boundary() const;
+
+    // https://drafts.csswg.org/css-contain-2/#skips-its-contents
+    // Set when the box was built for an element that skips its contents, e.g. an off-screen `content-visibility: auto`
+    // element. Such a box has no children, and is sized as if it were empty (or by its contain-intrinsic-size).
+    bool contents_are_skipped() const { return m_contents_are_skipped; }
+    void set_contents_are_skipped(bool contents_are_skipped) { m_contents_are_skipped = contents_are_skipped; }
 
 protected:
     Box(DOM::Document&, DOM::Node*, GC::Ref<CSS::ComputedProperties>);
@@ -82,6 +107,9 @@ private:
     Vector<GC::Ref<Node>> m_contained_abspos_children;
 
     OwnPtr<IntrinsicSizes> mutable m_cached_intrinsic_sizes;
+    OwnPtr<CachedTableGrid> mutable m_cached_table_grid;
+
+    bool m_contents_are_skipped { false };
 };
 
 template<>
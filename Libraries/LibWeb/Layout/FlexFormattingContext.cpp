@@ -9,6 +9,7 @@
 #include <AK/StdLibExtras.h>
 #include <LibWeb/Layout/Box.h>
 #include <LibWeb/Layout/FlexFormattingContext.h>
+#include <LibWeb/Layout/LayoutTrace.h>
 #include <LibWeb/Layout/ReplacedBox.h>
 #include <LibWeb/Layout/TextNode.h>
 #include <LibWeb/Layout/Viewport.h>
@@ -57,6 +58,8 @@ void FlexFormattingContext::run(AvailableSpace const& available_space)
         return;
     }
 
+    LayoutTraceScope trace_scope { *this };
+
     m_available_space = available_space;
 
     // 1. Generate anonymous flex items
@@ -197,12 +200,14 @@ void FlexFormattingContext::run(AvailableSpace const& available_space)
         // This is a normal layout (not intrinsic sizing).
         // AD-HOC: Finally, layout the inside of all flex items.
         copy_dimensions_from_flex_items_to_boxes();
-        for (auto& item : m_flex_items) {
-            if (auto independent_formatting_context = layout_inside(item.box, LayoutMode::Normal, item.used_values.available_inner_space_or_constraints_from(m_available_space_for_items->space)))
-                independent_formatting_context->parent_context_did_dimension_child_root_box();
+        Vector<IndependentChild> items;
+        items.ensure_capacity(m_flex_items.size());
+        for (auto& item : m_flex_items)
+            items.unchecked_append({ item.box, item.used_values.available_inner_space_or_constraints_from(m_available_space_for_items->space) });
+        layout_inside_independent_children(items);
 
+        for (auto& item : m_flex_items)
             compute_inset(item.box, content_box_rect(m_flex_container_state).size());
-        }
     }
 }
 
@@ -4,12 +4,16 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/Element.h>
 #include <LibWeb/Dump.h>
 #include <LibWeb/Layout/BlockFormattingContext.h>
 #include <LibWeb/Layout/Box.h>
 #include <LibWeb/Layout/FlexFormattingContext.h>
 #include <LibWeb/Layout/FormattingContext.h>
 #include <LibWeb/Layout/GridFormattingContext.h>
+#include <LibWeb/Layout/LayoutTrace.h>
+#include <LibWeb/Layout/ParallelLayout.h>
 #include <LibWeb/Layout/ReplacedBox.h>
 #include <LibWeb/Layout/SVGFormattingContext.h>
 #include <LibWeb/Layout/SVGSVGBox.h>
@@ -196,12 +200,52 @@ struct DummyFormattingContext : public FormattingContext {
     virtual void run(AvailableSpace const&) override { }
 };
 
+// https://drafts.csswg.org/css-contain-2/#skips-its-contents
+// Formatting context for a box whose contents are skipped. The box has no children to lay out, and is sized as if it
+// were empty, unless contain-intrinsic-size gives it an explicit intrinsic inner size.
+struct SkippedContentsFormattingContext : public FormattingContext {
+    SkippedContentsFormattingContext(LayoutState& state, LayoutMode layout_mode, Box const& box)
+        : FormattingContext(Type::InternalDummy, layout_mode, state, box)
+    {
+    }
+    virtual CSSPixels automatic_content_width() const override { return explicit_intrinsic_inner_size(context_box().computed_values().contain_intrinsic_width(), Axis::Horizontal); }
+    virtual CSSPixels automatic_content_height() const override { return explicit_intrinsic_inner_size(context_box().computed_values().contain_intrinsic_height(), Axis::Vertical); }
+    virtual void run(AvailableSpace const&) override { }
+
+private:
+    enum class Axis {
+        Horizontal,
+        Vertical,
+    };
+
+    // https://drafts.csswg.org/css-sizing-4/#intrinsic-size-override
+    CSSPixels explicit_intrinsic_inner_size(CSS::ContainIntrinsicSize const& contain_intrinsic_size, Axis axis) const
+    {
+        // If the element has a last remembered size and is currently skipping its contents, its explicit intrinsic
+        // inner size in the corresponding axis is the last remembered size in that axis.
+        if (contain_intrinsic_size.use_last_remembered_size) {
+            if (auto const* element = as_if<DOM::Element>(context_box().dom_node())) {
+                if (auto last_remembered_size = element->last_remembered_size(); last_remembered_size.has_value())
+                    return axis == Axis::Horizontal ? last_remembered_size->width() : last_remembered_size->height();
+            }
+        }
+
+        // Otherwise, the element has an explicit intrinsic inner size of the specified <length>, or none.
+        if (contain_intrinsic_size.length.has_value())
+            return contain_intrinsic_size.length->to_px(context_box());
+        return 0;
+    }
+};
+
 OwnPtr<FormattingContext> FormattingContext::create_independent_formatting_context_if_needed(LayoutState& state, LayoutMode layout_mode, Box const& child_box)
 {
     auto type = formatting_context_type_created_by_box(child_box);
     if (!type.has_value())
         return nullptr;
 
+    if (child_box.contents_are_skipped())
+        return make<SkippedContentsFormattingContext>(state, layout_mode, child_box);
+
     switch (type.value()) {
     case Type::Block:
         return make<BlockFormattingContext>(state, layout_mode, as<BlockContainer>(child_box), this);
@@ -254,6 +298,53 @@ OwnPtr<FormattingContext> FormattingContext::layout_inside(Box const& child_box,
     return independent_formatting_context;
 }
 
+void FormattingContext::layout_inside_independent_children(Vector<IndependentChild> const& children)
+{
+    Vector<IndependentChild const*> parallel_children;
+    if (m_layout_mode == LayoutMode::Normal && can_run_layout_tasks_in_parallel()) {
+        for (auto const& child : children) {
+            if (can_lay_out_in_parallel(child.box))
+                parallel_children.append(&child);
+        }
+        if (parallel_children.size() < 2)
+            parallel_children.clear();
+    }
+
+    // NOTE: parallel_children is in the same order as children, so we only ever need to look at its next entry.
+    size_t next_parallel_child_index = 0;
+    for (auto const& child : children) {
+        if (next_parallel_child_index < parallel_children.size() && parallel_children[next_parallel_child_index] == &child) {
+            ++next_parallel_child_index;
+            continue;
+        }
+        if (auto independent_formatting_context = layout_inside(child.box, LayoutMode::Normal, child.available_space))
+            independent_formatting_context->parent_context_did_dimension_child_root_box();
+    }
+
+    if (parallel_children.is_empty())
+        return;
+
+    // Each child is laid out in a scratch state of its own, which reads the used values of the boxes around it from
+    // our state. Merging the scratch states in child order keeps the result independent of thread scheduling.
+    Vector<NonnullOwnPtr<LayoutState>> scratch_states;
+    Vector<Function<void()>> tasks;
+    for (auto const* child : parallel_children) {
+        scratch_states.append(make<LayoutState>(&m_state));
+        scratch_states.last()->copy_used_values_from_parent(child->box);
+        tasks.append([this, child, &scratch_state = *scratch_states.last()] {
+            auto independent_formatting_context = create_independent_formatting_context_if_needed(scratch_state, LayoutMode::Normal, child->box);
+            VERIFY(independent_formatting_context);
+            independent_formatting_context->run(child->available_space);
+            independent_formatting_context->parent_context_did_dimension_child_root_box();
+        });
+    }
+
+    run_layout_tasks(tasks);
+
+    for (auto const& scratch_state : scratch_states)
+        m_state.merge_scratch_state(*scratch_state);
+}
+
 CSSPixels FormattingContext::greatest_child_width(Box const& box) const
 {
     CSSPixels max_width = 0;
@@ -1439,6 +1530,16 @@ CSSPixels FormattingContext::calculate_fit_content_height(Layout::Box const& box
     return calculate_max_content_height(box, available_space.width.to_px_or_zero());
 }
 
+static bool record_intrinsic_size_cache_lookup(Box const& box, bool hit)
+{
+    // NOTE: Formatting contexts only ever see const boxes, but recording a lookup doesn't change anything layout depends on.
+    auto& statistics = const_cast<DOM::Document&>(box.document()).intrinsic_size_cache_statistics();
+    ++(hit ? statistics.hits : statistics.misses);
+    if (auto* trace = box.document().layout_trace())
+        trace->record_intrinsic_size_cache_lookup(box, hit);
+    return hit;
+}
+
 CSSPixels FormattingContext::calculate_min_content_width(Layout::Box const& box) const
 {
     if (box.is_replaced_box()) {
@@ -1459,9 +1560,11 @@ CSSPixels FormattingContext::calculate_min_content_width(Layout::Box const& box)
         return *box.natural_width();
 
     auto& cache = box.cached_intrinsic_sizes().min_content_width;
-    if (cache.has_value())
+    if (record_intrinsic_size_cache_lookup(box, cache.has_value()))
         return cache.value();
 
+    LayoutTraceScope trace_scope { box, LayoutTrace::IntrinsicSize::MinContentWidth };
+
     LayoutState throwaway_state;
 
     auto& box_state = throwaway_state.get_mutable(box);
@@ -1491,9 +1594,11 @@ CSSPixels FormattingContext::calculate_max_content_width(Layout::Box const& box)
         return *box.natural_width();
 
     auto& cache = box.cached_intrinsic_sizes().max_content_width;
-    if (cache.has_value())
+    if (record_intrinsic_size_cache_lookup(box, cache.has_value()))
         return cache.value();
 
+    LayoutTraceScope trace_scope { box, LayoutTrace::IntrinsicSize::MaxContentWidth };
+
     LayoutState throwaway_state;
 
     auto& box_state = throwaway_state.get_mutable(box);
@@ -1531,9 +1636,11 @@ CSSPixels FormattingContext::calculate_min_content_height(Layout::Box const& box
     }
 
     auto& cache = box.cached_intrinsic_sizes().min_content_height.ensure(width);
-    if (cache.has_value())
+    if (record_intrinsic_size_cache_lookup(box, cache.has_value()))
         return cache.value();
 
+    LayoutTraceScope trace_scope { box, LayoutTrace::IntrinsicSize::MinContentHeight };
+
     LayoutState throwaway_state;
 
     auto& box_state = throwaway_state.get_mutable(box);
@@ -1562,9 +1669,11 @@ CSSPixels FormattingContext::calculate_max_content_height(Layout::Box const& box
         return *box.natural_height();
 
     auto& cache_slot = box.cached_intrinsic_sizes().max_content_height.ensure(width);
-    if (cache_slot.has_value())
+    if (record_intrinsic_size_cache_lookup(box, cache_slot.has_value()))
         return cache_slot.value();
 
+    LayoutTraceScope trace_scope { box, LayoutTrace::IntrinsicSize::MaxContentHeight };
+
     LayoutState throwaway_state;
 
     auto& box_state = throwaway_state.get_mutable(box);
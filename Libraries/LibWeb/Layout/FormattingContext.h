@@ -111,6 +111,16 @@ protected:
 
     OwnPtr<FormattingContext> layout_inside(Box const&, LayoutMode, AvailableSpace const&);
 
+    struct IndependentChild {
+        GC::Ref<Box const> box;
+        AvailableSpace available_space;
+    };
+
+    // Lays out the inside of each child and lets its formatting context know that the child has been dimensioned.
+    // The children must have been dimensioned already, and their layouts must not depend on each other. When parallel
+    // layout is enabled, the children that allow it are laid out on the layout threads (see ParallelLayout.h).
+    void layout_inside_independent_children(Vector<IndependentChild> const&);
+
     struct SpaceUsedByFloats {
         CSSPixels left { 0 };
         CSSPixels right { 0 };
@@ -9,6 +9,7 @@
 #include <LibWeb/DOM/Node.h>
 #include <LibWeb/Layout/Box.h>
 #include <LibWeb/Layout/GridFormattingContext.h>
+#include <LibWeb/Layout/LayoutTrace.h>
 #include <LibWeb/Layout/ReplacedBox.h>
 
 namespace Web::Layout {
@@ -455,9 +456,14 @@ void GridFormattingContext::place_item_with_column_position(Box const& child_box
         .column_span = column_span });
 }
 
-FoundUnoccupiedPlace OccupationGrid::find_unoccupied_place(GridDimension dimension, int& column_index, int& row_index, int column_span, int row_span) const
+FoundUnoccupiedPlace OccupationGrid::find_unoccupied_place(GridDimension dimension, int& column_index, int& row_index, int column_span, int row_span)
 {
     if (dimension == GridDimension::Column) {
+        // OPTIMIZATION: None of the rows before the first one with room for the item would match below, so skip them.
+        if (auto first_row = first_row_with_room_for_span(column_span); row_index < first_row) {
+            row_index = first_row;
+            column_index = min_column_index();
+        }
         while (row_index <= max_row_index()) {
             while (column_index <= max_column_index()) {
                 auto enough_span_for_span = column_index + column_span - 1 <= max_column_index();
@@ -469,6 +475,10 @@ FoundUnoccupiedPlace OccupationGrid::find_unoccupied_place(GridDimension dimensi
             column_index = min_column_index();
         }
     } else {
+        if (auto first_column = first_column_with_room_for_span(row_span); column_index < first_column) {
+            column_index = first_column;
+            row_index = min_row_index();
+        }
         while (column_index <= max_column_index()) {
             while (row_index <= max_row_index()) {
                 auto enough_span_for_span = row_index + row_span - 1 <= max_row_index();
@@ -734,17 +744,25 @@ void GridFormattingContext::resolve_intrinsic_track_sizes(GridDimension dimensio
 
     // FIXME: 1. Shim baseline-aligned items so their intrinsic size contributions reflect their baseline alignment.
 
-    // 2. Size tracks to fit non-spanning items:
-    increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(dimension, 1);
+    // NOTE: Items are grouped by span up front, so that each of the following steps only visits the items it considers.
+    Vector<Vector<GridItem&>> items_by_span;
+    for (auto& item : m_grid_items) {
+        auto span = item.span(dimension);
+        if (span == 0)
+            continue;
+        if (items_by_span.size() < span)
+            items_by_span.resize(span);
+        items_by_span[span - 1].append(item);
+    }
 
+    // 2. Size tracks to fit non-spanning items:
     // 3. Increase sizes to accommodate spanning items crossing content-sized tracks: Next, consider the
     // items with a span of 2 that do not span a track with a flexible sizing function.
     // Repeat incrementally for items with greater spans until all items have been considered.
-    size_t max_item_span = 1;
-    for (auto& item : m_grid_items)
-        max_item_span = max(item.span(dimension), max_item_span);
-    for (size_t span = 2; span <= max_item_span; span++)
-        increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(dimension, span);
+    for (auto const& items_of_same_span : items_by_span) {
+        if (!items_of_same_span.is_empty())
+            increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(dimension, items_of_same_span);
+    }
 
     // 4. Increase sizes to accommodate spanning items crossing flexible tracks: Next, repeat the previous
     // step instead considering (together, rather than grouped by span size) all items that do span a
@@ -919,15 +937,23 @@ void GridFormattingContext::distribute_extra_space_across_spanned_tracks_growth_
     }
 }
 
-void GridFormattingContext::increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(GridDimension dimension, size_t span)
+template<typename Tracks>
+static void increase_growth_limits_to_match_base_sizes(Tracks& tracks)
 {
-    auto& available_size = dimension == GridDimension::Column ? m_available_space->width : m_available_space->height;
-    auto& tracks = dimension == GridDimension::Column ? m_grid_columns : m_grid_rows;
-    for (auto& item : m_grid_items) {
-        auto const item_span = item.span(dimension);
-        if (item_span != span)
+    for (auto& track : tracks) {
+        if (track.is_gap)
             continue;
+        if (track.growth_limit.has_value() && track.growth_limit.value() < track.base_size)
+            track.growth_limit = track.base_size;
+    }
+}
 
+void GridFormattingContext::increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(GridDimension dimension, Vector<GridItem&> const& items_of_same_span)
+{
+    auto& available_size = dimension == GridDimension::Column ? m_available_space->width : m_available_space->height;
+    auto& tracks = dimension == GridDimension::Column ? m_grid_columns : m_grid_rows;
+    Optional<Vector<GridTrack&>> previous_item_spanned_tracks;
+    for (auto const& item : items_of_same_span) {
         Vector<GridTrack&> spanned_tracks;
         for_each_spanned_track_by_item(item, dimension, [&](GridTrack& track) {
             spanned_tracks.append(track);
@@ -984,9 +1010,13 @@ void GridFormattingContext::increase_sizes_to_accommodate_spanning_items_crossin
 
         // 4. If at this point any track’s growth limit is now less than its base size, increase its growth limit to
         //    match its base size.
-        for (auto& track : tracks) {
-            if (track.growth_limit.has_value() && track.growth_limit.value() < track.base_size)
-                track.growth_limit = track.base_size;
+        // OPTIMIZATION: Only the tracks spanned by this item and the previous one can have changed since every track
+        //               was last checked.
+        if (previous_item_spanned_tracks.has_value()) {
+            increase_growth_limits_to_match_base_sizes(*previous_item_spanned_tracks);
+            increase_growth_limits_to_match_base_sizes(spanned_tracks);
+        } else {
+            increase_growth_limits_to_match_base_sizes(tracks);
         }
 
         // 5. For intrinsic maximums: Next increase the growth limit of tracks with an intrinsic max track sizing
@@ -1031,6 +1061,8 @@ void GridFormattingContext::increase_sizes_to_accommodate_spanning_items_crossin
             }
             track.planned_increase = 0;
         }
+
+        previous_item_spanned_tracks = move(spanned_tracks);
     }
 }
 
@@ -1038,6 +1070,7 @@ void GridFormattingContext::increase_sizes_to_accommodate_spanning_items_crossin
 {
     auto& tracks = dimension == GridDimension::Column ? m_grid_columns : m_grid_rows;
     auto const& available_size = dimension == GridDimension::Column ? m_available_space->width : m_available_space->height;
+    Optional<Vector<GridTrack&>> previous_item_spanned_tracks;
     for (auto& item : m_grid_items) {
         Vector<GridTrack&> spanned_tracks;
         for_each_spanned_track_by_item(item, dimension, [&](GridTrack& track) {
@@ -1071,10 +1104,14 @@ void GridFormattingContext::increase_sizes_to_accommodate_spanning_items_crossin
 
         // 4. If at this point any track’s growth limit is now less than its base size, increase its growth limit to
         //    match its base size.
-        for (auto& track : tracks) {
-            if (track.growth_limit.has_value() && track.growth_limit.value() < track.base_size)
-                track.growth_limit = track.base_size;
+        if (previous_item_spanned_tracks.has_value()) {
+            increase_growth_limits_to_match_base_sizes(*previous_item_spanned_tracks);
+            increase_growth_limits_to_match_base_sizes(spanned_tracks);
+        } else {
+            increase_growth_limits_to_match_base_sizes(tracks);
         }
+
+        previous_item_spanned_tracks = move(spanned_tracks);
     }
 }
 
@@ -1319,6 +1356,10 @@ void GridFormattingContext::run_track_sizing(GridDimension dimension)
     // https://www.w3.org/TR/css-grid-2/#algo-track-sizing
     // 12.3. Track Sizing Algorithm
 
+    // NOTE: The available space and the sizes of the items in the other dimension may have changed since the last run.
+    for (auto& item : m_grid_items)
+        item.cached_contributions(dimension) = {};
+
     // 1. Initialize Track Sizes
     initialize_track_sizes(dimension);
 
@@ -1445,34 +1486,39 @@ void GridFormattingContext::place_grid_items()
 
     // FIXME: 0. Generate anonymous grid items
 
+    // NOTE: Placed boxes are dropped by rebuilding each bucket, as removing them one at a time would be quadratic in
+    //       the number of items.
+
     // 1. Position anything that's not auto-positioned.
     for (auto key : keys) {
         auto& boxes_to_place = order_item_bucket.get(key).value();
-        for (size_t i = 0; i < boxes_to_place.size(); i++) {
-            auto const& child_box = boxes_to_place[i];
+        Vector<GC::Ref<Box const>> boxes_left_to_place;
+        for (auto const& child_box : boxes_to_place) {
             auto const& computed_values = child_box->computed_values();
             if (is_auto_positioned_track(computed_values.grid_row_start(), computed_values.grid_row_end())
-                || is_auto_positioned_track(computed_values.grid_column_start(), computed_values.grid_column_end()))
+                || is_auto_positioned_track(computed_values.grid_column_start(), computed_values.grid_column_end())) {
+                boxes_left_to_place.append(child_box);
                 continue;
+            }
             place_item_with_row_and_column_position(child_box);
-            boxes_to_place.remove(i);
-            i--;
         }
+        boxes_to_place = move(boxes_left_to_place);
     }
 
     // 2. Process the items locked to a given row.
     // FIXME: Do "dense" packing
     for (auto key : keys) {
         auto& boxes_to_place = order_item_bucket.get(key).value();
-        for (size_t i = 0; i < boxes_to_place.size(); i++) {
-            auto const& child_box = boxes_to_place[i];
+        Vector<GC::Ref<Box const>> boxes_left_to_place;
+        for (auto const& child_box : boxes_to_place) {
             auto const& computed_values = child_box->computed_values();
-            if (is_auto_positioned_track(computed_values.grid_row_start(), computed_values.grid_row_end()))
+            if (is_auto_positioned_track(computed_values.grid_row_start(), computed_values.grid_row_end())) {
+                boxes_left_to_place.append(child_box);
                 continue;
+            }
             place_item_with_row_position(child_box);
-            boxes_to_place.remove(i);
-            i--;
         }
+        boxes_to_place = move(boxes_left_to_place);
     }
 
     // 3. Determine the columns in the implicit grid.
@@ -1517,8 +1563,7 @@ void GridFormattingContext::place_grid_items()
     auto auto_placement_cursor_y = 0;
     for (auto key : keys) {
         auto& boxes_to_place = order_item_bucket.get(key).value();
-        for (size_t i = 0; i < boxes_to_place.size(); i++) {
-            auto const& child_box = boxes_to_place[i];
+        for (auto const& child_box : boxes_to_place) {
             auto const& computed_values = child_box->computed_values();
             // 4.1. For sparse packing:
             // FIXME: no distinction made. See #4.2
@@ -1531,11 +1576,9 @@ void GridFormattingContext::place_grid_items()
             else
                 place_item_with_no_declared_position(child_box, auto_placement_cursor_x, auto_placement_cursor_y);
 
-            boxes_to_place.remove(i);
-            i--;
-
             // FIXME: 4.2. For dense packing:
         }
+        boxes_to_place.clear();
     }
 
     // NOTE: When final implicit grid sizes are known, we can offset their positions so leftmost grid track has 0 index.
@@ -1968,6 +2011,8 @@ void GridFormattingContext::run(AvailableSpace const& available_space)
         return;
     }
 
+    LayoutTraceScope trace_scope { *this };
+
     m_available_space = available_space;
 
     init_grid_lines(GridDimension::Column);
@@ -2063,6 +2108,8 @@ void GridFormattingContext::run(AvailableSpace const& available_space)
         return;
     }
 
+    Vector<IndependentChild> items;
+    items.ensure_capacity(m_grid_items.size());
     for (auto& grid_item : m_grid_items) {
         CSSPixelPoint margin_offset = { grid_item.used_values.margin_box_left(), grid_item.used_values.margin_box_top() };
         auto const grid_area_rect = get_grid_area_rect(grid_item);
@@ -2072,9 +2119,9 @@ void GridFormattingContext::run(AvailableSpace const& available_space)
         auto available_space_for_children = AvailableSpace(AvailableSize::make_definite(grid_item.used_values.content_width()), AvailableSize::make_definite(grid_item.used_values.content_height()));
         grid_item.used_values.set_has_definite_width(true);
         grid_item.used_values.set_has_definite_height(true);
-        if (auto independent_formatting_context = layout_inside(grid_item.box, LayoutMode::Normal, available_space_for_children))
-            independent_formatting_context->parent_context_did_dimension_child_root_box();
+        items.unchecked_append({ grid_item.box, available_space_for_children });
     }
+    layout_inside_independent_children(items);
 
     auto serialize = [](auto const& tracks, auto const& lines) {
         CSS::GridTrackSizeList result;
@@ -2369,6 +2416,11 @@ void GridFormattingContext::init_grid_lines(GridDimension dimension)
 
 void OccupationGrid::set_occupied(int column_start, int column_end, int row_start, int row_end)
 {
+    auto old_min_column_index = m_min_column_index;
+    auto old_max_column_index = m_max_column_index;
+    auto old_min_row_index = m_min_row_index;
+    auto old_max_row_index = m_max_row_index;
+
     for (int row_index = row_start; row_index < row_end; row_index++) {
         for (int column_index = column_start; column_index < column_end; column_index++) {
             m_min_column_index = min(m_min_column_index, column_index);
@@ -2379,6 +2431,13 @@ void OccupationGrid::set_occupied(int column_start, int column_end, int row_star
             m_occupation_grid.set(GridPosition { .row = row_index, .column = column_index });
         }
     }
+
+    // The remembered rows stay valid only while rows are added at the end: new columns add free cells to every row,
+    // and new rows at the start come before the remembered ones. The same goes for the remembered columns.
+    if (m_min_column_index != old_min_column_index || m_max_column_index != old_max_column_index || m_min_row_index != old_min_row_index)
+        m_first_row_with_room_for_column_span.clear();
+    if (m_min_row_index != old_min_row_index || m_max_row_index != old_max_row_index || m_min_column_index != old_min_column_index)
+        m_first_column_with_room_for_row_span.clear();
 }
 
 bool OccupationGrid::is_occupied(int column_index, int row_index) const
@@ -2386,6 +2445,40 @@ bool OccupationGrid::is_occupied(int column_index, int row_index) const
     return m_occupation_grid.contains(GridPosition { row_index, column_index });
 }
 
+bool OccupationGrid::row_has_room_for_span(int row_index, int column_span) const
+{
+    for (int column_index = m_min_column_index; column_index + column_span - 1 <= m_max_column_index; column_index++) {
+        if (!is_occupied(column_index, row_index))
+            return true;
+    }
+    return false;
+}
+
+bool OccupationGrid::column_has_room_for_span(int column_index, int row_span) const
+{
+    for (int row_index = m_min_row_index; row_index + row_span - 1 <= m_max_row_index; row_index++) {
+        if (!is_occupied(column_index, row_index))
+            return true;
+    }
+    return false;
+}
+
+int OccupationGrid::first_row_with_room_for_span(int column_span)
+{
+    auto& row_index = m_first_row_with_room_for_column_span.ensure(column_span, [&] { return m_min_row_index; });
+    while (row_index <= m_max_row_index && !row_has_room_for_span(row_index, column_span))
+        row_index++;
+    return row_index;
+}
+
+int OccupationGrid::first_column_with_room_for_span(int row_span)
+{
+    auto& column_index = m_first_column_with_room_for_row_span.ensure(row_span, [&] { return m_min_column_index; });
+    while (column_index <= m_max_column_index && !column_has_room_for_span(column_index, row_span))
+        column_index++;
+    return column_index;
+}
+
 int GridItem::gap_adjusted_row() const
 {
     return row.value() * 2;
@@ -2430,6 +2523,14 @@ CSSPixels GridFormattingContext::containing_block_size_for_item(GridItem const&
 }
 
 CSSPixels GridFormattingContext::calculate_min_content_contribution(GridItem const& item, GridDimension dimension) const
+{
+    auto& cached_contribution = item.cached_contributions(dimension).min_content;
+    if (!cached_contribution.has_value())
+        cached_contribution = calculate_uncached_min_content_contribution(item, dimension);
+    return cached_contribution.value();
+}
+
+CSSPixels GridFormattingContext::calculate_uncached_min_content_contribution(GridItem const& item, GridDimension dimension) const
 {
     auto available_space_for_item = item.available_space();
 
@@ -2460,6 +2561,10 @@ CSSPixels GridFormattingContext::calculate_min_content_contribution(GridItem con
 
 CSSPixels GridFormattingContext::calculate_max_content_contribution(GridItem const& item, GridDimension dimension) const
 {
+    auto& cached_contribution = item.cached_contributions(dimension).max_content;
+    if (cached_contribution.has_value())
+        return cached_contribution.value();
+
     auto available_space_for_item = item.available_space();
 
     auto should_treat_preferred_size_as_auto = [&] {
@@ -2477,7 +2582,9 @@ CSSPixels GridFormattingContext::calculate_max_content_contribution(GridItem con
     if (should_treat_preferred_size_as_auto || preferred_size.is_fit_content()) {
         auto fit_content_size = dimension == GridDimension::Column ? calculate_fit_content_width(item.box, available_space_for_item) : calculate_fit_content_height(item.box, available_space_for_item);
         auto result = item.add_margin_box_sizes(fit_content_size, dimension);
-        return min(result, maximum_size);
+        // NOTE: Unlike a preferred size resolved against the spanned tracks below, this doesn't change as tracks grow.
+        cached_contribution = min(result, maximum_size);
+        return cached_contribution.value();
     }
 
     auto containing_block_size = containing_block_size_for_item(item, dimension);
@@ -130,6 +130,21 @@ struct GridItem {
         auto available_height = used_values.has_definite_height() ? AvailableSize::make_definite(used_values.content_height()) : AvailableSize::make_indefinite();
         return { available_width, available_height };
     }
+
+    // Size contributions that don't depend on the sizes of the tracks. They are needed by several steps of the track
+    // sizing algorithm, so they're computed once per run of it.
+    struct CachedContributions {
+        Optional<CSSPixels> min_content;
+        Optional<CSSPixels> max_content;
+    };
+
+    CachedContributions& cached_contributions(GridDimension dimension) const
+    {
+        return dimension == GridDimension::Column ? cached_column_contributions : cached_row_contributions;
+    }
+
+    mutable CachedContributions cached_column_contributions {};
+    mutable CachedContributions cached_row_contributions {};
 };
 
 enum class FoundUnoccupiedPlace {
@@ -158,7 +173,11 @@ public:
         return abs(m_min_row_index) + m_max_row_index + 1;
     }
 
-    void set_max_column_index(size_t max_column_index) { m_max_column_index = max_column_index; }
+    void set_max_column_index(size_t max_column_index)
+    {
+        m_max_column_index = max_column_index;
+        m_first_row_with_room_for_column_span.clear();
+    }
 
     int min_column_index() const { return m_min_column_index; }
     int max_column_index() const { return m_max_column_index; }
@@ -167,11 +186,22 @@ public:
 
     bool is_occupied(int column_index, int row_index) const;
 
-    FoundUnoccupiedPlace find_unoccupied_place(GridDimension dimension, int& column_index, int& row_index, int column_span, int row_span) const;
+    FoundUnoccupiedPlace find_unoccupied_place(GridDimension dimension, int& column_index, int& row_index, int column_span, int row_span);
 
 private:
+    bool row_has_room_for_span(int row_index, int column_span) const;
+    bool column_has_room_for_span(int column_index, int row_span) const;
+    int first_row_with_room_for_span(int column_span);
+    int first_column_with_room_for_span(int row_span);
+
     HashTable<GridPosition> m_occupation_grid;
 
+    // Cells are only ever occupied, never freed, so a row without room to start an item of a given span stays that way
+    // until the grid grows along it. Remembering the first row with room lets auto-placement skip the filled part of
+    // the grid instead of rescanning it for every item. Keyed by span; the same goes for columns.
+    HashMap<int, int> m_first_row_with_room_for_column_span;
+    HashMap<int, int> m_first_column_with_room_for_row_span;
+
     int m_min_column_index { 0 };
     int m_max_column_index { 0 };
     int m_min_row_index { 0 };
@@ -366,7 +396,7 @@ private:
 
     void initialize_track_sizes(GridDimension);
     void resolve_intrinsic_track_sizes(GridDimension);
-    void increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(GridDimension, size_t span);
+    void increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(GridDimension, Vector<GridItem&> const& items_of_same_span);
     void increase_sizes_to_accommodate_spanning_items_crossing_flexible_tracks(GridDimension);
     void maximize_tracks_using_available_size(AvailableSpace const& available_space, GridDimension dimension);
     void maximize_tracks(GridDimension);
@@ -380,6 +410,7 @@ private:
     CSSPixels calculate_max_content_size(GridItem const&, GridDimension) const;
 
     CSSPixels calculate_min_content_contribution(GridItem const&, GridDimension) const;
+    CSSPixels calculate_uncached_min_content_contribution(GridItem const&, GridDimension) const;
     CSSPixels calculate_max_content_contribution(GridItem const&, GridDimension) const;
 
     CSSPixels calculate_limited_min_content_contribution(GridItem const&, GridDimension) const;
@@ -12,6 +12,7 @@
 #include <LibWeb/Layout/Box.h>
 #include <LibWeb/Layout/InlineFormattingContext.h>
 #include <LibWeb/Layout/InlineLevelIterator.h>
+#include <LibWeb/Layout/LayoutTrace.h>
 #include <LibWeb/Layout/LineBuilder.h>
 
 namespace Web::Layout {
@@ -82,6 +83,8 @@ CSSPixels InlineFormattingContext::automatic_content_height() const
 
 void InlineFormattingContext::run(AvailableSpace const& available_space)
 {
+    LayoutTraceScope trace_scope { *this };
+
     VERIFY(containing_block().children_are_inline());
     m_available_space = available_space;
     generate_line_boxes();
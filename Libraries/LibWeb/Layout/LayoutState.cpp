@@ -11,6 +11,7 @@
 #include <LibWeb/Layout/AvailableSpace.h>
 #include <LibWeb/Layout/InlineNode.h>
 #include <LibWeb/Layout/LayoutState.h>
+#include <LibWeb/Layout/ParallelLayout.h>
 #include <LibWeb/Layout/Viewport.h>
 #include <LibWeb/Painting/SVGPathPaintable.h>
 #include <LibWeb/Painting/SVGSVGPaintable.h>
@@ -22,32 +23,132 @@ LayoutState::~LayoutState()
 {
 }
 
+LayoutState::UsedValues* LayoutState::find_used_values(NodeWithStyle const& node) const
+{
+    auto index = node.layout_index();
+    UsedValues* used_values = nullptr;
+    if (m_used_values_pages.is_empty()) {
+        used_values = m_used_values_by_layout_index.get(index).value_or(nullptr);
+    } else {
+        auto page_index = index / used_values_page_size;
+        if (page_index >= m_used_values_pages.size() || !m_used_values_pages[page_index])
+            return nullptr;
+        used_values = (*m_used_values_pages[page_index])[index % used_values_page_size];
+    }
+    // The slot may still refer to a node that was discarded by commit_subtree().
+    if (!used_values || used_values->is_discarded() || &used_values->node() != &node)
+        return nullptr;
+    return used_values;
+}
+
+LayoutState::UsedValues const* LayoutState::find_used_values_in_parents(NodeWithStyle const& node) const
+{
+    for (auto const* state = m_parent; state; state = state->m_parent) {
+        if (auto const* used_values = state->find_used_values(node))
+            return used_values;
+    }
+    return nullptr;
+}
+
+LayoutState::UsedValues& LayoutState::append_used_values(NodeWithStyle const& node, UsedValues&& new_used_values) const
+{
+    m_used_values.append(move(new_used_values));
+    auto& used_values = m_used_values[m_used_values.size() - 1];
+
+    set_used_values_slot(node.layout_index(), used_values);
+    return used_values;
+}
+
+void LayoutState::set_used_values_slot(u32 layout_index, UsedValues& used_values) const
+{
+    if (m_used_values_pages.is_empty()) {
+        if (m_used_values_by_layout_index.size() < max_used_values_in_hash_map) {
+            m_used_values_by_layout_index.set(layout_index, &used_values);
+            return;
+        }
+
+        // This state has grown too large for the hash map, so we move its used values over to the page table.
+        auto used_values_by_layout_index = move(m_used_values_by_layout_index);
+        m_used_values_pages.resize(layout_index / used_values_page_size + 1);
+        for (auto const& [index, used_values_in_hash_map] : used_values_by_layout_index)
+            set_used_values_slot(index, *used_values_in_hash_map);
+    }
+
+    auto page_index = layout_index / used_values_page_size;
+    if (page_index >= m_used_values_pages.size())
+        m_used_values_pages.resize(page_index + 1);
+    if (!m_used_values_pages[page_index])
+        m_used_values_pages[page_index] = make<UsedValuesPage>();
+    (*m_used_values_pages[page_index])[layout_index % used_values_page_size] = &used_values;
+}
+
+LayoutState::UsedValues& LayoutState::create_used_values(NodeWithStyle const& node) const
+{
+    auto const* containing_block_used_values = node.is_viewport() ? nullptr : &get(*node.containing_block());
+
+    UsedValues new_used_values;
+    new_used_values.set_node(const_cast<NodeWithStyle&>(node), containing_block_used_values);
+    return append_used_values(node, move(new_used_values));
+}
+
 LayoutState::UsedValues& LayoutState::get_mutable(NodeWithStyle const& node)
 {
-    if (auto* used_values = used_values_per_layout_node.get(node).value_or(nullptr))
+    if (auto* used_values = find_used_values(node))
         return *used_values;
 
-    auto const* containing_block_used_values = node.is_viewport() ? nullptr : &get(*node.containing_block());
+    if (auto const* parent_used_values = find_used_values_in_parents(node)) {
+        // NOTE: Layout tasks mustn't copy used values out of the parent state, see copy_used_values_from_parent().
+        VERIFY(!is_running_layout_tasks());
+        auto& used_values = append_used_values(node, UsedValues(*parent_used_values));
+        used_values.m_containing_block_used_values = node.is_viewport() ? nullptr : &get(*node.containing_block());
+        return used_values;
+    }
 
-    auto new_used_values = adopt_own(*new UsedValues);
-    auto* new_used_values_ptr = new_used_values.ptr();
-    new_used_values->set_node(const_cast<NodeWithStyle&>(node), containing_block_used_values);
-    used_values_per_layout_node.set(node, move(new_used_values));
-    return *new_used_values_ptr;
+    return create_used_values(node);
 }
 
 LayoutState::UsedValues const& LayoutState::get(NodeWithStyle const& node) const
 {
-    if (auto const* used_values = used_values_per_layout_node.get(node).value_or(nullptr))
+    if (auto const* used_values = find_used_values(node))
         return *used_values;
+    if (auto const* used_values = find_used_values_in_parents(node))
+        return *used_values;
+    return create_used_values(node);
+}
 
-    auto const* containing_block_used_values = node.is_viewport() ? nullptr : &get(*node.containing_block());
+LayoutState::UsedValues const* LayoutState::try_get(NodeWithStyle const& node) const
+{
+    if (auto const* used_values = find_used_values(node))
+        return used_values;
+    return find_used_values_in_parents(node);
+}
+
+void LayoutState::merge_scratch_state(LayoutState const& scratch)
+{
+    VERIFY(scratch.m_parent == this);
 
-    auto new_used_values = adopt_own(*new UsedValues);
-    auto* new_used_values_ptr = new_used_values.ptr();
-    new_used_values->set_node(const_cast<NodeWithStyle&>(node), containing_block_used_values);
-    const_cast<LayoutState*>(this)->used_values_per_layout_node.set(node, move(new_used_values));
-    return *new_used_values_ptr;
+    // NOTE: Used values are merged in the order the scratch state created them, which keeps the order in which
+    //       commit() visits them independent of how the scratch states were scheduled.
+    for (auto const& scratch_used_values : scratch.m_used_values) {
+        if (scratch_used_values.is_discarded())
+            continue;
+        auto const& node = scratch_used_values.node();
+        auto& used_values = get_mutable(node);
+        used_values = scratch_used_values;
+        used_values.m_containing_block_used_values = node.is_viewport() ? nullptr : &get(*node.containing_block());
+    }
+}
+
+void LayoutState::copy_used_values_from_parent(Box const& root)
+{
+    VERIFY(m_parent);
+
+    // NOTE: Containing blocks come before the boxes they contain in tree order, so the copies refer to each other.
+    root.for_each_in_inclusive_subtree_of_type<NodeWithStyle>([&](NodeWithStyle const& node) {
+        if (find_used_values_in_parents(node))
+            (void)get_mutable(node);
+        return TraversalDecision::Continue;
+    });
 }
 
 // https://drafts.csswg.org/css-overflow-3/#scrollable-overflow-region
@@ -163,9 +264,10 @@ void LayoutState::resolve_relative_positions()
 {
     // This function resolves relative position offsets of fragments that belong to inline paintables.
     // It runs *after* the paint tree has been constructed, so it modifies paintable node & fragment offsets directly.
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
-        auto& node = const_cast<NodeWithStyle&>(used_values.node());
+    for (auto& used_values : m_used_values) {
+        if (used_values.is_discarded())
+            continue;
+        auto& node = used_values.node();
 
         for (auto& paintable : node.paintables()) {
             if (!(is<Painting::PaintableWithLines>(paintable) && is<Layout::InlineNode>(paintable.layout_node())))
@@ -246,6 +348,89 @@ void LayoutState::commit(Box& root)
         return TraversalDecision::Continue;
     });
 
+    commit_used_values(root, inline_nodes, nullptr, nullptr);
+}
+
+void LayoutState::commit_subtree(Box& root)
+{
+    // The used values of the containing blocks were only needed to lay out the inside of `root`.
+    for (auto& used_values : m_used_values) {
+        if (!used_values.is_discarded() && !root.is_inclusive_ancestor_of(used_values.node()))
+            used_values.discard();
+    }
+
+    auto& old_paintable = *root.paintable_box();
+    GC::Ptr<Painting::Paintable> parent_paintable = old_paintable.parent();
+    GC::Ptr<Painting::Paintable> next_sibling_paintable = old_paintable.next_sibling();
+    VERIFY(parent_paintable);
+
+    old_paintable.for_each_in_inclusive_subtree([&](Painting::Paintable& paintable) {
+        paintable.detach_from_layout_node();
+        return TraversalDecision::Continue;
+    });
+    parent_paintable->remove_child(old_paintable);
+
+    // NOTE: Unlike commit(), this goes through the layout tree rather than the DOM tree, since a DOM descendant of
+    //       `root` may have its box somewhere else in the layout tree (e.g. in the top layer).
+    HashTable<Layout::InlineNode*> inline_nodes;
+
+    root.for_each_in_inclusive_subtree([&](Layout::Node& node) {
+        node.clear_paintables();
+        if (auto* dom_node = node.dom_node())
+            dom_node->clear_paintable();
+        if (auto* inline_node = as_if<InlineNode>(node))
+            inline_nodes.set(inline_node);
+        return TraversalDecision::Continue;
+    });
+
+    commit_used_values(root, inline_nodes, parent_paintable, next_sibling_paintable);
+}
+
+bool LayoutState::populate_from_paintables(Box const& box)
+{
+    Vector<Box const*> boxes;
+    for (auto const* current = &box; current; current = current->containing_block())
+        boxes.append(current);
+
+    // NOTE: Containing blocks go first, since the used values of a box refer to those of its containing block.
+    for (auto const* current : boxes.in_reverse()) {
+        auto const* paintable_box = current->paintable_box();
+        if (!paintable_box)
+            return false;
+
+        auto& used_values = get_mutable(*current);
+        used_values.set_content_width(paintable_box->content_width());
+        used_values.set_content_height(paintable_box->content_height());
+
+        auto const& box_model = paintable_box->box_model();
+        used_values.inset_left = box_model.inset.left;
+        used_values.inset_right = box_model.inset.right;
+        used_values.inset_top = box_model.inset.top;
+        used_values.inset_bottom = box_model.inset.bottom;
+        used_values.padding_left = box_model.padding.left;
+        used_values.padding_right = box_model.padding.right;
+        used_values.padding_top = box_model.padding.top;
+        used_values.padding_bottom = box_model.padding.bottom;
+        used_values.border_left = box_model.border.left;
+        used_values.border_right = box_model.border.right;
+        used_values.border_top = box_model.border.top;
+        used_values.border_bottom = box_model.border.bottom;
+        used_values.margin_left = box_model.margin.left;
+        used_values.margin_right = box_model.margin.right;
+        used_values.margin_top = box_model.margin.top;
+        used_values.margin_bottom = box_model.margin.bottom;
+
+        // The relative position inset has already been applied to the offset of the paintable.
+        auto offset = paintable_box->offset();
+        if (current->computed_values().position() == CSS::Positioning::Relative)
+            offset.translate_by(-box_model.inset.left, -box_model.inset.top);
+        used_values.set_content_offset(offset);
+    }
+    return true;
+}
+
+void LayoutState::commit_used_values(Box& root, HashTable<InlineNode*> const& inline_nodes, Painting::Paintable* parent_paintable, Painting::Paintable* next_sibling_paintable)
+{
     HashTable<Layout::TextNode*> text_nodes;
     HashTable<Painting::PaintableWithLines*> inline_node_paintables;
 
@@ -262,7 +447,7 @@ void LayoutState::commit(Box& root)
                 auto& inline_node = const_cast<InlineNode&>(static_cast<InlineNode const&>(*parent));
                 auto line_paintable = inline_node.create_paintable_for_line_with_index(line_index);
                 line_paintable->add_fragment(fragment);
-                if (auto const* used_values = used_values_per_layout_node.get(inline_node).value_or(nullptr))
+                if (auto const* used_values = try_get(inline_node))
                     transfer_box_model_metrics(line_paintable->box_model(), *used_values);
                 if (!inline_node_paintables.contains(line_paintable.ptr())) {
                     inline_node_paintables.set(line_paintable.ptr());
@@ -274,8 +459,9 @@ void LayoutState::commit(Box& root)
         return false;
     };
 
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& used_values : m_used_values) {
+        if (used_values.is_discarded())
+            continue;
         auto& node = const_cast<NodeWithStyle&>(used_values.node());
 
         auto paintable = node.create_paintable();
@@ -336,15 +522,16 @@ void LayoutState::commit(Box& root)
         auto line_paintable = inline_node->create_paintable_for_line_with_index(0);
         inline_node->add_paintable(line_paintable);
         inline_node_paintables.set(line_paintable.ptr());
-        if (auto const* used_values = used_values_per_layout_node.get(*inline_node).value_or(nullptr))
+        if (auto const* used_values = try_get(*inline_node))
             transfer_box_model_metrics(line_paintable->box_model(), *used_values);
     }
 
     // Resolve relative positions for regular boxes (not line box fragments):
     // NOTE: This needs to occur before fragments are transferred into the corresponding inline paintables, because
     //       after this transfer, the containing_line_box_fragment will no longer be valid.
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& used_values : m_used_values) {
+        if (used_values.is_discarded())
+            continue;
         auto& node = const_cast<NodeWithStyle&>(used_values.node());
 
         if (!node.is_box())
@@ -381,6 +568,8 @@ void LayoutState::commit(Box& root)
     }
 
     build_paint_tree(root);
+    if (parent_paintable)
+        parent_paintable->insert_before(*root.first_paintable(), next_sibling_paintable);
 
     resolve_relative_positions();
 
@@ -430,8 +619,9 @@ void LayoutState::commit(Box& root)
     }
 
     // Measure overflow in scroll containers.
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& used_values : m_used_values) {
+        if (used_values.is_discarded())
+            continue;
         if (!used_values.node().is_box())
             continue;
         auto const& box = static_cast<Layout::Box const&>(used_values.node());
@@ -445,8 +635,9 @@ void LayoutState::commit(Box& root)
             paintable_box.set_scroll_offset(paintable_box.scroll_offset());
     }
 
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& used_values : m_used_values) {
+        if (used_values.is_discarded())
+            continue;
         auto& node = used_values.node();
         for (auto& paintable : node.paintables()) {
             Painting::PaintableBox* paintable_box = nullptr;
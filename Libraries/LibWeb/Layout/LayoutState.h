@@ -6,7 +6,9 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/HashMap.h>
+#include <AK/SegmentedVector.h>
 #include <LibGfx/Path.h>
 #include <LibGfx/Point.h>
 #include <LibWeb/Layout/Box.h>
@@ -60,6 +62,10 @@ struct LayoutState {
         NodeWithStyle& node() { return const_cast<NodeWithStyle&>(*m_node); }
         void set_node(NodeWithStyle&, UsedValues const* containing_block_used_values);
 
+        // Discarded used values stay allocated in their LayoutState, but no longer belong to any node.
+        bool is_discarded() const { return !m_node; }
+        void discard() { m_node = nullptr; }
+
         UsedValues const* containing_block_used_values() const { return m_containing_block_used_values; }
 
         CSSPixels content_width() const { return m_content_width; }
@@ -197,20 +203,74 @@ struct LayoutState {
         RefPtr<CSS::GridTrackSizeListStyleValue const> m_grid_template_rows;
 
         Optional<StaticPositionRect> m_static_position_rect;
+
+        friend struct LayoutState;
     };
 
+    LayoutState() = default;
+
+    // Creates a scratch state on top of `parent`. Used values that the scratch state doesn't have yet are read from
+    // `parent`, and copied into the scratch state the first time they are mutated, so `parent` is never written to.
+    // `parent` must outlive the scratch state, and must not be mutated while the scratch state is in use.
+    explicit LayoutState(LayoutState const* parent)
+        : m_parent(parent)
+    {
+    }
+
     ~LayoutState();
 
+    // Copies all the used values of `scratch`, which must have been created on top of this state, into this state.
+    void merge_scratch_state(LayoutState const& scratch);
+
+    // Copies the used values that the parent state has for `root` and its descendants into this scratch state.
+    // Copying used values touches the reference counts of what they hold, which isn't thread-safe, so this must be done
+    // on the main thread for every subtree that is laid out in a layout task. Layout tasks then only ever read from
+    // the parent state.
+    void copy_used_values_from_parent(Box const& root);
+
     // Commits the used values produced by layout and builds a paintable tree.
     void commit(Box& root);
 
+    // Like commit(), but only replaces the paintables of `root` and its descendants, leaving the rest of the paintable
+    // tree untouched. Used values for nodes outside of `root` are discarded.
+    void commit_subtree(Box& root);
+
+    // Seeds the used values of `box` and its chain of containing blocks from the paintables of the previous layout,
+    // so that the inside of `box` can be laid out again without laying out its ancestors.
+    // Returns false if any of them doesn't have a paintable.
+    [[nodiscard]] bool populate_from_paintables(Box const&);
+
     UsedValues& get_mutable(NodeWithStyle const&);
     UsedValues const& get(NodeWithStyle const&) const;
 
-    OrderedHashMap<GC::Ref<Layout::Node const>, NonnullOwnPtr<UsedValues>> used_values_per_layout_node;
+    // Returns null instead of creating the used values if `node` hasn't been laid out in this state.
+    UsedValues const* try_get(NodeWithStyle const&) const;
 
 private:
+    UsedValues* find_used_values(NodeWithStyle const&) const;
+    UsedValues const* find_used_values_in_parents(NodeWithStyle const&) const;
+    UsedValues& create_used_values(NodeWithStyle const&) const;
+    UsedValues& append_used_values(NodeWithStyle const&, UsedValues&&) const;
+
+    void commit_used_values(Box& root, HashTable<InlineNode*> const&, Painting::Paintable* parent_paintable, Painting::Paintable* next_sibling_paintable);
     void resolve_relative_positions();
+
+    // Used values are allocated in segments, in the order they were created, and are looked up by the layout index
+    // of their node (see Node::layout_index()) in a table of fixed-size pages. That avoids both hashing and a heap
+    // allocation per node.
+    // States that only lay out a few nodes, like the throwaway states of intrinsic sizing, would still need a page
+    // directory covering the layout index of every node they touch. So they look up their used values in a hash map
+    // instead, until they grow large enough to switch to the page table.
+    // NOTE: Discarded used values must be skipped when iterating.
+    static constexpr size_t used_values_page_size = 256;
+    static constexpr size_t max_used_values_in_hash_map = 256;
+    using UsedValuesPage = Array<UsedValues*, used_values_page_size>;
+    void set_used_values_slot(u32 layout_index, UsedValues&) const;
+    mutable HashMap<u32, UsedValues*> m_used_values_by_layout_index;
+    mutable Vector<OwnPtr<UsedValuesPage>> m_used_values_pages;
+    mutable SegmentedVector<UsedValues, 32> m_used_values;
+
+    LayoutState const* m_parent { nullptr };
 };
 
 inline CSSPixels clamp_to_max_dimension_value(CSSPixels value)
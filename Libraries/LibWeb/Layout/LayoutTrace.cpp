@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <AK/JsonArraySerializer.h>
+#include <AK/JsonObjectSerializer.h>
+#include <AK/QuickSort.h>
+#include <AK/StringBuilder.h>
+#include <LibCore/System.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/Layout/Box.h>
+#include <LibWeb/Layout/FormattingContext.h>
+#include <LibWeb/Layout/LayoutTrace.h>
+
+namespace Web::Layout {
+
+// The per-box counters are only reported for the boxes that took the most time, to keep traces of large pages readable.
+static constexpr size_t max_reported_box_count = 100;
+
+static StringView formatting_context_type_name(FormattingContext::Type type)
+{
+    switch (type) {
+    case FormattingContext::Type::Block:
+        return "Block"sv;
+    case FormattingContext::Type::Inline:
+        return "Inline"sv;
+    case FormattingContext::Type::Flex:
+        return "Flex"sv;
+    case FormattingContext::Type::Grid:
+        return "Grid"sv;
+    case FormattingContext::Type::Table:
+        return "Table"sv;
+    case FormattingContext::Type::SVG:
+        return "SVG"sv;
+    case FormattingContext::Type::InternalReplaced:
+        return "InternalReplaced"sv;
+    case FormattingContext::Type::InternalDummy:
+        return "InternalDummy"sv;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+static StringView intrinsic_size_name(LayoutTrace::IntrinsicSize intrinsic_size)
+{
+    switch (intrinsic_size) {
+    case LayoutTrace::IntrinsicSize::MinContentWidth:
+        return "min-content width"sv;
+    case LayoutTrace::IntrinsicSize::MaxContentWidth:
+        return "max-content width"sv;
+    case LayoutTrace::IntrinsicSize::MinContentHeight:
+        return "min-content height"sv;
+    case LayoutTrace::IntrinsicSize::MaxContentHeight:
+        return "max-content height"sv;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// Chrome trace events identify threads by number, so we hand out small numbers in the order threads first record.
+static u32 current_thread_index()
+{
+    static Atomic<u32> s_next_thread_index { 1 };
+    static thread_local u32 s_thread_index = 0;
+    if (s_thread_index == 0)
+        s_thread_index = s_next_thread_index.fetch_add(1);
+    return s_thread_index;
+}
+
+static double to_microseconds(AK::Duration duration)
+{
+    return static_cast<double>(duration.to_nanoseconds()) / 1000;
+}
+
+// Describes a box by the path to its DOM node, e.g. "html > body > div#main.content". Anonymous boxes and boxes of
+// pseudo-elements have no DOM node of their own, so they are described by their layout node under that path.
+static String path_of_box(Box const& box)
+{
+    Vector<String> components;
+
+    Node const* node = &box;
+    for (; node && !node->dom_node(); node = node->parent())
+        components.append(node->debug_description());
+
+    if (node) {
+        for (auto const* dom_node = node->dom_node(); dom_node && !dom_node->is_document(); dom_node = dom_node->parent_or_shadow_host())
+            components.append(dom_node->debug_description());
+    }
+
+    if (components.is_empty())
+        return "#document"_string;
+
+    components.reverse();
+    return MUST(String::join(" > "sv, components));
+}
+
+LayoutTrace::LayoutTrace()
+    : m_start_time(MonotonicTime::now())
+{
+}
+
+LayoutTrace* LayoutTrace::for_node(Node const& node)
+{
+    return node.document().layout_trace();
+}
+
+void LayoutTrace::record_event(Event event, AK::Duration self_time)
+{
+    Threading::MutexLocker locker(m_mutex);
+
+    auto record = [&](Counters& counters) {
+        ++counters.count;
+        counters.total_time += event.duration;
+        counters.self_time += self_time;
+    };
+
+    record(m_counters_by_name.ensure(event.name));
+    if (event.box)
+        record(m_counters_by_box.ensure(event.box));
+
+    m_events.append(move(event));
+}
+
+void LayoutTrace::record_intrinsic_size_cache_lookup(Box const& box, bool hit)
+{
+    Threading::MutexLocker locker(m_mutex);
+
+    auto& counters = m_counters_by_box.ensure(box);
+    ++(hit ? counters.intrinsic_size_cache_hits : counters.intrinsic_size_cache_misses);
+}
+
+String LayoutTrace::serialize_as_chrome_trace_events() const
+{
+    Threading::MutexLocker locker(m_mutex);
+
+    HashMap<Box const*, String> box_paths;
+    auto path_of = [&](Box const& box) -> String const& {
+        return box_paths.ensure(&box, [&] { return path_of_box(box); });
+    };
+
+    StringBuilder builder;
+    auto trace = MUST(JsonObjectSerializer<>::try_create(builder));
+
+    // https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+    auto trace_events = MUST(trace.add_array("traceEvents"sv));
+    auto process_id = Core::System::getpid();
+    for (auto const& event : m_events) {
+        auto trace_event = MUST(trace_events.add_object());
+        MUST(trace_event.add("name"sv, event.name));
+        MUST(trace_event.add("cat"sv, event.category));
+        MUST(trace_event.add("ph"sv, "X"sv));
+        MUST(trace_event.add("ts"sv, to_microseconds(event.start - m_start_time)));
+        MUST(trace_event.add("dur"sv, to_microseconds(event.duration)));
+        MUST(trace_event.add("pid"sv, process_id));
+        MUST(trace_event.add("tid"sv, event.thread_index));
+        if (event.box) {
+            auto args = MUST(trace_event.add_object("args"sv));
+            MUST(args.add("box"sv, path_of(*event.box)));
+            MUST(args.finish());
+        }
+        MUST(trace_event.finish());
+    }
+    MUST(trace_events.finish());
+
+    MUST(trace.add("displayTimeUnit"sv, "ms"sv));
+
+    // Any other keys are kept as metadata by trace viewers, so we include the aggregated counters as well.
+    auto counters = MUST(trace.add_object("layoutCounters"sv));
+    for (auto const& [name, name_counters] : m_counters_by_name) {
+        auto counters_object = MUST(counters.add_object(name));
+        MUST(counters_object.add("count"sv, name_counters.count));
+        MUST(counters_object.add("totalTime"sv, to_microseconds(name_counters.total_time)));
+        MUST(counters_object.add("selfTime"sv, to_microseconds(name_counters.self_time)));
+        MUST(counters_object.finish());
+    }
+    MUST(counters.finish());
+
+    Vector<GC::Ptr<Box const>> boxes;
+    boxes.ensure_capacity(m_counters_by_box.size());
+    for (auto const& it : m_counters_by_box)
+        boxes.unchecked_append(it.key);
+    quick_sort(boxes, [&](auto const& a, auto const& b) {
+        return m_counters_by_box.get(a)->self_time > m_counters_by_box.get(b)->self_time;
+    });
+    if (boxes.size() > max_reported_box_count)
+        boxes.shrink(max_reported_box_count);
+
+    auto box_counters = MUST(trace.add_array("layoutBoxCounters"sv));
+    for (auto const& box : boxes) {
+        auto const& counters_of_box = *m_counters_by_box.get(box);
+        auto box_object = MUST(box_counters.add_object());
+        MUST(box_object.add("box"sv, path_of(*box)));
+        MUST(box_object.add("count"sv, counters_of_box.count));
+        MUST(box_object.add("totalTime"sv, to_microseconds(counters_of_box.total_time)));
+        MUST(box_object.add("selfTime"sv, to_microseconds(counters_of_box.self_time)));
+        MUST(box_object.add("intrinsicSizeCacheHits"sv, counters_of_box.intrinsic_size_cache_hits));
+        MUST(box_object.add("intrinsicSizeCacheMisses"sv, counters_of_box.intrinsic_size_cache_misses));
+        MUST(box_object.finish());
+    }
+    MUST(box_counters.finish());
+
+    MUST(trace.finish());
+    return MUST(builder.to_string());
+}
+
+void LayoutTrace::visit_edges(GC::Cell::Visitor& visitor)
+{
+    // NOTE: Every box that an event refers to has counters, so this keeps the boxes of all events alive.
+    for (auto const& it : m_counters_by_box)
+        visitor.visit(it.key);
+}
+
+static thread_local LayoutTraceScope* s_current_scope = nullptr;
+
+LayoutTraceScope::LayoutTraceScope(LayoutTrace* trace, StringView name, StringView category, Box const* box)
+    : m_trace(trace)
+    , m_name(name)
+    , m_category(category)
+    , m_box(box)
+{
+    if (!m_trace)
+        return;
+    m_start = MonotonicTime::now();
+    m_parent = s_current_scope;
+    s_current_scope = this;
+}
+
+LayoutTraceScope::LayoutTraceScope(FormattingContext const& context)
+    : LayoutTraceScope(LayoutTrace::for_node(context.context_box()), formatting_context_type_name(context.type()), "formatting-context"sv, &context.context_box())
+{
+}
+
+LayoutTraceScope::LayoutTraceScope(Box const& box, LayoutTrace::IntrinsicSize intrinsic_size)
+    : LayoutTraceScope(LayoutTrace::for_node(box), intrinsic_size_name(intrinsic_size), "intrinsic-size"sv, &box)
+{
+}
+
+LayoutTraceScope::LayoutTraceScope(DOM::Document const& document, StringView name)
+    : LayoutTraceScope(document.layout_trace(), name, "update-layout"sv, nullptr)
+{
+}
+
+LayoutTraceScope::~LayoutTraceScope()
+{
+    if (!m_trace)
+        return;
+
+    auto duration = MonotonicTime::now() - *m_start;
+    s_current_scope = m_parent;
+    if (m_parent)
+        m_parent->m_nested_time += duration;
+
+    m_trace->record_event({ m_name, m_category, m_box, *m_start, duration, current_thread_index() }, duration - m_nested_time);
+}
+
+}
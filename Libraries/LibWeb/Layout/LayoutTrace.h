@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibGC/Cell.h>
+#include <LibGC/Ptr.h>
+#include <LibThreading/Mutex.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::Layout {
+
+// Records where layout spends its time while it is enabled for a document, see Document::start_layout_trace().
+// The trace is serialized in the Chrome trace event format, so that it can be loaded into chrome://tracing or Perfetto,
+// along with counters that are aggregated per formatting context type, per intrinsic size and per box.
+class LayoutTrace {
+    AK_MAKE_NONCOPYABLE(LayoutTrace);
+    AK_MAKE_NONMOVABLE(LayoutTrace);
+
+public:
+    enum class IntrinsicSize : u8 {
+        MinContentWidth,
+        MaxContentWidth,
+        MinContentHeight,
+        MaxContentHeight,
+    };
+
+    LayoutTrace();
+
+    // Returns the trace that is being recorded for the document of `node`, if any.
+    static LayoutTrace* for_node(Node const&);
+
+    void record_intrinsic_size_cache_lookup(Box const&, bool hit);
+
+    String serialize_as_chrome_trace_events() const;
+
+    void visit_edges(GC::Cell::Visitor&);
+
+private:
+    friend class LayoutTraceScope;
+
+    struct Event {
+        StringView name;
+        StringView category;
+        GC::Ptr<Box const> box;
+        MonotonicTime start;
+        AK::Duration duration;
+        u32 thread_index { 0 };
+    };
+
+    struct Counters {
+        u64 count { 0 };
+        AK::Duration total_time;
+        // The total time minus the time spent in nested events, which is what points at the boxes that are expensive
+        // to lay out themselves rather than the ancestors of such boxes.
+        AK::Duration self_time;
+    };
+
+    struct BoxCounters : Counters {
+        u64 intrinsic_size_cache_hits { 0 };
+        u64 intrinsic_size_cache_misses { 0 };
+    };
+
+    void record_event(Event, AK::Duration self_time);
+
+    MonotonicTime m_start_time;
+
+    // NOTE: Boxes can be laid out on the layout thread pool (see Layout/ParallelLayout.h), so all recording happens
+    //       with this mutex held.
+    mutable Threading::Mutex m_mutex;
+    Vector<Event> m_events;
+    OrderedHashMap<StringView, Counters> m_counters_by_name;
+    HashMap<GC::Ptr<Box const>, BoxCounters> m_counters_by_box;
+};
+
+// Records the lifetime of the enclosing scope as an event in the layout trace of the document, if one is being recorded.
+class LayoutTraceScope {
+    AK_MAKE_NONCOPYABLE(LayoutTraceScope);
+    AK_MAKE_NONMOVABLE(LayoutTraceScope);
+
+public:
+    explicit LayoutTraceScope(FormattingContext const&);
+    LayoutTraceScope(Box const&, LayoutTrace::IntrinsicSize);
+    LayoutTraceScope(DOM::Document const&, StringView name);
+    ~LayoutTraceScope();
+
+private:
+    LayoutTraceScope(LayoutTrace*, StringView name, StringView category, Box const*);
+
+    LayoutTrace* m_trace { nullptr };
+    StringView m_name;
+    StringView m_category;
+    Box const* m_box { nullptr };
+    Optional<MonotonicTime> m_start;
+    LayoutTraceScope* m_parent { nullptr };
+    AK::Duration m_nested_time;
+};
+
+}
@@ -7,6 +7,7 @@
  */
 
 #include <AK/Demangle.h>
+#include <AK/NeverDestroyed.h>
 #include <LibWeb/CSS/ComputedProperties.h>
 #include <LibWeb/CSS/StyleValues/AbstractImageStyleValue.h>
 #include <LibWeb/CSS/StyleValues/BackgroundSizeStyleValue.h>
@@ -28,6 +29,7 @@
 #include <LibWeb/Layout/BlockContainer.h>
 #include <LibWeb/Layout/FormattingContext.h>
 #include <LibWeb/Layout/Node.h>
+#include <LibWeb/Layout/ParallelLayout.h>
 #include <LibWeb/Layout/TableWrapper.h>
 #include <LibWeb/Layout/TextNode.h>
 #include <LibWeb/Layout/Viewport.h>
@@ -37,15 +39,34 @@
 
 namespace Web::Layout {
 
+// Layout indices are recycled as soon as their node is destroyed, so they stay dense enough to index tables with.
+// NOTE: Layout nodes are only created and destroyed on the main thread, outside of layout tasks, so these don't need
+//       to be atomic.
+static u32 s_next_layout_index = 0;
+static NeverDestroyed<Vector<u32>> s_free_layout_indices;
+
+static u32 allocate_layout_index()
+{
+    VERIFY(!is_running_layout_tasks());
+    if (!s_free_layout_indices->is_empty())
+        return s_free_layout_indices->take_last();
+    return s_next_layout_index++;
+}
+
 Node::Node(DOM::Document& document, DOM::Node* node)
     : m_dom_node(node ? *node : document)
+    , m_layout_index(allocate_layout_index())
     , m_anonymous(node == nullptr)
 {
     if (node)
         node->set_layout_node({}, *this);
 }
 
-Node::~Node() = default;
+Node::~Node()
+{
+    VERIFY(!is_running_layout_tasks());
+    s_free_layout_indices->append(m_layout_index);
+}
 
 void Node::visit_edges(Cell::Visitor& visitor)
 {
@@ -1036,6 +1057,8 @@ void NodeWithStyle::apply_style(CSS::ComputedProperties const& computed_style)
     computed_values.set_mix_blend_mode(computed_style.mix_blend_mode());
     computed_values.set_view_transition_name(computed_style.view_transition_name());
     computed_values.set_contain(computed_style.contain());
+    computed_values.set_contain_intrinsic_width(computed_style.contain_intrinsic_width(*this));
+    computed_values.set_contain_intrinsic_height(computed_style.contain_intrinsic_height(*this));
     computed_values.set_shape_rendering(computed_values.shape_rendering());
     computed_values.set_will_change(computed_style.will_change());
 
@@ -1489,8 +1512,27 @@ void NodeWithStyleAndBoxModelMetrics::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_continuation_of_node);
 }
 
+Box* Node::nearest_ancestor_layout_boundary()
+{
+    for (auto* ancestor = parent(); ancestor; ancestor = ancestor->parent()) {
+        if (auto* box = as_if<Box>(*ancestor); box && box->is_layout_boundary())
+            return box;
+    }
+    return nullptr;
+}
+
 void Node::set_needs_layout_update(DOM::SetNeedsLayoutReason reason)
 {
+    // NOTE: We may already need a layout update on behalf of a descendant, which may be inside a layout boundary that
+    //       doesn't contain us and whose changes don't affect our intrinsic sizes. So we only skip the work below if
+    //       we were marked ourselves.
+    if (m_was_marked_for_layout_update)
+        return;
+    m_was_marked_for_layout_update = true;
+
+    document().did_mark_layout_node_for_layout_update({}, *this);
+    invalidate_cached_intrinsic_sizes();
+
     if (m_needs_layout_update)
         return;
 
@@ -1519,4 +1561,40 @@ void Node::set_needs_layout_update(DOM::SetNeedsLayoutReason reason)
     }
 }
 
+void Node::invalidate_cached_intrinsic_sizes()
+{
+    auto& statistics = document().intrinsic_size_cache_statistics();
+    auto reset = [&](Node const& node) {
+        auto const* box = as_if<Box>(node);
+        if (!box)
+            return;
+        if (box->reset_cached_intrinsic_sizes())
+            ++statistics.invalidations;
+        // NOTE: Table parts are never layout boundaries or absolutely positioned, so any change to the rows and cells of
+        //       a table makes it here.
+        box->reset_cached_table_grid();
+    };
+
+    reset(*this);
+
+    // Anonymous boxes we generated inherit our style.
+    for_each_child_of_type<Box>([&](Box& child) {
+        if (child.is_anonymous())
+            reset(child);
+        return IterationDecision::Continue;
+    });
+
+    // Changes inside a layout boundary can't affect its size, and out-of-flow boxes don't contribute to the intrinsic
+    // sizes of their ancestors, so there's no need to look past either of them. Our own size may have changed though.
+    for (Node* node = this; node->parent(); node = node->parent()) {
+        if (node != this) {
+            if (node->is_absolutely_positioned())
+                break;
+            if (auto const* box = as_if<Box>(*node); box && box->is_layout_boundary())
+                break;
+        }
+        reset(*node->parent());
+    }
+}
+
 }
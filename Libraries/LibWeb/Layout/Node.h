@@ -45,9 +45,24 @@ public:
     DOM::Element const* pseudo_element_generator() const;
     DOM::Element* pseudo_element_generator();
 
+    // A small integer that is unique among the live layout nodes, used to look up per-node layout state
+    // without hashing. Indices of destroyed nodes are handed out again to new nodes.
+    u32 layout_index() const { return m_layout_index; }
+
     bool needs_layout_update() const { return m_needs_layout_update; }
     void set_needs_layout_update(DOM::SetNeedsLayoutReason);
-    void reset_needs_layout_update() { m_needs_layout_update = false; }
+    void reset_needs_layout_update()
+    {
+        m_needs_layout_update = false;
+        m_was_marked_for_layout_update = false;
+    }
+
+    // Clears the cached intrinsic sizes of every box whose intrinsic sizes may depend on this node.
+    void invalidate_cached_intrinsic_sizes();
+
+    // The nearest ancestor that is a layout boundary, i.e. the root of the smallest subtree that has to be laid out
+    // again when this node changes. Returns null if the whole tree has to be laid out again.
+    Box* nearest_ancestor_layout_boundary();
 
     bool is_generated() const { return m_generated_for.has_value(); }
     Optional<CSS::PseudoElement> generated_for_pseudo_element() const { return m_generated_for; }
@@ -215,6 +230,8 @@ private:
 
     GC::Ptr<DOM::Element> m_pseudo_element_generator;
 
+    u32 m_layout_index { 0 };
+
     bool m_anonymous { false };
     bool m_has_style { false };
     bool m_children_are_inline { false };
@@ -225,6 +242,8 @@ private:
     bool m_has_been_wrapped_in_table_wrapper { false };
 
     bool m_needs_layout_update { false };
+    // Whether set_needs_layout_update() was called on this node itself, rather than only on one of its descendants.
+    bool m_was_marked_for_layout_update { false };
 
     Optional<CSS::PseudoElement> m_generated_for {};
 
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <AK/NeverDestroyed.h>
+#include <LibCore/System.h>
+#include <LibThreading/WorkerThread.h>
+#include <LibWeb/Layout/BlockContainer.h>
+#include <LibWeb/Layout/FormattingContext.h>
+#include <LibWeb/Layout/Label.h>
+#include <LibWeb/Layout/ParallelLayout.h>
+
+namespace Web::Layout {
+
+bool g_parallel_layout_enabled = false;
+
+static constexpr size_t max_layout_thread_count = 8;
+
+using LayoutThread = Threading::WorkerThread<Error>;
+
+static Vector<NonnullOwnPtr<LayoutThread>> create_layout_threads()
+{
+    Vector<NonnullOwnPtr<LayoutThread>> threads;
+
+    // NOTE: The thread that starts a batch of layout tasks runs them too, so it doesn't need a layout thread of its own.
+    //       There is always at least one layout thread, so that machines with a single core run the same code.
+    auto thread_count = clamp<size_t>(Core::System::hardware_concurrency(), 2, max_layout_thread_count);
+    for (size_t i = 1; i < thread_count; ++i) {
+        auto thread = LayoutThread::create("Layout"sv);
+        if (thread.is_error()) {
+            dbgln("Unable to create layout thread: {}", thread.error());
+            break;
+        }
+        threads.append(thread.release_value());
+    }
+    return threads;
+}
+
+static Vector<NonnullOwnPtr<LayoutThread>>& layout_threads()
+{
+    static NeverDestroyed<Vector<NonnullOwnPtr<LayoutThread>>> threads { create_layout_threads() };
+    return *threads;
+}
+
+// Set on every thread that is currently running layout tasks, so that nested batches don't wait on busy threads.
+static thread_local bool s_is_running_layout_tasks = false;
+
+// Only ever updated by the thread that starts a batch, which is never a layout thread.
+static ParallelLayoutStatistics s_statistics;
+
+static bool uses_calculated_values(CSS::ComputedValues const& computed_values)
+{
+    auto is_calculated = [](CSS::LengthBox const& box) {
+        return box.top().is_calculated() || box.right().is_calculated() || box.bottom().is_calculated() || box.left().is_calculated();
+    };
+
+    if (computed_values.width().is_calculated() || computed_values.min_width().is_calculated() || computed_values.max_width().is_calculated())
+        return true;
+    if (computed_values.height().is_calculated() || computed_values.min_height().is_calculated() || computed_values.max_height().is_calculated())
+        return true;
+    if (is_calculated(computed_values.margin()) || is_calculated(computed_values.padding()) || is_calculated(computed_values.inset()))
+        return true;
+    if (auto const* flex_basis = computed_values.flex_basis().get_pointer<CSS::Size>(); flex_basis && flex_basis->is_calculated())
+        return true;
+    for (auto const* gap : { &computed_values.row_gap(), &computed_values.column_gap() }) {
+        if (auto const* length_percentage = gap->get_pointer<CSS::LengthPercentage>(); length_percentage && length_percentage->is_calculated())
+            return true;
+    }
+    return false;
+}
+
+static bool can_lay_out_node_in_parallel(Node const& node)
+{
+    // Only plain block and flex containers are allowed. Inline content needs text shaping, and replaced elements,
+    // SVG, lists, tables and grids each consult state that is shared between boxes.
+    auto const* block_container = as_if<BlockContainer>(node);
+    if (!block_container)
+        return false;
+    if (block_container->is_list_item_box() || block_container->is_fieldset_box() || block_container->is_legend_box()
+        || block_container->is_table_wrapper() || block_container->is_svg_foreign_object_box() || is<Label>(*block_container))
+        return false;
+    if (block_container->display().is_grid_inside() || block_container->display().is_table_inside())
+        return false;
+    if (block_container->children_are_inline() && block_container->has_children())
+        return false;
+
+    // Absolutely positioned boxes are laid out by their containing block, which may be outside of the subtree.
+    if (block_container->is_absolutely_positioned())
+        return false;
+
+    // Calculated values that can't be compiled are resolved by walking their calculation tree, which isn't known to be
+    // thread-safe.
+    return !uses_calculated_values(block_container->computed_values());
+}
+
+bool can_lay_out_in_parallel(Box const& box)
+{
+    if (!FormattingContext::formatting_context_type_created_by_box(box).has_value())
+        return false;
+
+    // Measuring intrinsic sizes inside of the task resolves the sizes of the containing blocks outside of the subtree
+    // too, so those mustn't use calculated values either.
+    for (auto containing_block = box.containing_block(); containing_block; containing_block = containing_block->containing_block()) {
+        if (uses_calculated_values(containing_block->computed_values()))
+            return false;
+    }
+
+    bool can_lay_out = true;
+    box.for_each_in_inclusive_subtree([&](Node const& node) {
+        if (can_lay_out_node_in_parallel(node))
+            return TraversalDecision::Continue;
+        can_lay_out = false;
+        return TraversalDecision::Break;
+    });
+    return can_lay_out;
+}
+
+bool is_running_layout_tasks()
+{
+    return s_is_running_layout_tasks;
+}
+
+bool can_run_layout_tasks_in_parallel()
+{
+    return g_parallel_layout_enabled && !s_is_running_layout_tasks && !layout_threads().is_empty();
+}
+
+ParallelLayoutStatistics const& parallel_layout_statistics()
+{
+    return s_statistics;
+}
+
+void run_layout_tasks(Span<Function<void()>> tasks)
+{
+    if (tasks.size() < 2 || !can_run_layout_tasks_in_parallel()) {
+        for (auto& task : tasks)
+            task();
+        return;
+    }
+
+    ++s_statistics.batches;
+    s_statistics.tasks += tasks.size();
+
+    // Each thread keeps taking the next task that hasn't been started yet, so that a few expensive tasks don't leave
+    // the other threads idle.
+    Atomic<size_t> next_task_index { 0 };
+    auto run_remaining_tasks = [&] {
+        s_is_running_layout_tasks = true;
+        for (auto index = next_task_index.fetch_add(1); index < tasks.size(); index = next_task_index.fetch_add(1))
+            tasks[index]();
+        s_is_running_layout_tasks = false;
+    };
+
+    auto& threads = layout_threads();
+    auto helper_thread_count = min(threads.size(), tasks.size() - 1);
+    for (size_t i = 0; i < helper_thread_count; ++i) {
+        auto did_start = threads[i]->start_task([&]() -> ErrorOr<void> {
+            run_remaining_tasks();
+            return {};
+        });
+        VERIFY(did_start);
+    }
+
+    run_remaining_tasks();
+
+    for (size_t i = 0; i < helper_thread_count; ++i)
+        MUST(threads[i]->wait_until_task_is_finished());
+}
+
+}
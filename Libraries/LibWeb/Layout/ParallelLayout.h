@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/Span.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::Layout {
+
+// When enabled, formatting contexts lay out independent children (such as flex and grid items) on a pool of
+// layout threads, each in a scratch LayoutState that is merged back into the parent state in child order.
+extern bool g_parallel_layout_enabled;
+
+// Returns whether the inside of `box` can be laid out on a layout thread. Layout code that runs for text, replaced
+// elements and SVG relies on process-wide caches that aren't thread-safe, so any subtree containing them has to be
+// laid out on the main thread. That currently leaves only subtrees made up entirely of block and flex containers
+// without any inline content, and whose containing blocks don't use calc().
+bool can_lay_out_in_parallel(Box const&);
+
+// Returns whether the calling thread is running layout tasks. While it is, other threads may be running layout tasks
+// as well, so anything that isn't thread-safe (such as reference counts and process-wide caches) must not be touched.
+bool is_running_layout_tasks();
+
+// Returns whether a batch of layout tasks started now would be spread over the layout threads.
+bool can_run_layout_tasks_in_parallel();
+
+struct ParallelLayoutStatistics {
+    size_t batches { 0 };
+    size_t tasks { 0 };
+};
+
+// Counts the batches of layout tasks (and the tasks in them) that were spread over the layout threads.
+ParallelLayoutStatistics const& parallel_layout_statistics();
+
+// Runs all of `tasks`, spread over the layout threads and the calling thread, and returns once all of them have
+// finished. Tasks run serially if parallel layout is disabled, or if called from within another layout task.
+void run_layout_tasks(Span<Function<void()>> tasks);
+
+}
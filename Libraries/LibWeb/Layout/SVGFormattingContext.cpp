@@ -13,6 +13,7 @@
 #include <LibGfx/Path.h>
 #include <LibGfx/TextLayout.h>
 #include <LibWeb/Layout/BlockFormattingContext.h>
+#include <LibWeb/Layout/LayoutTrace.h>
 #include <LibWeb/Layout/SVGClipBox.h>
 #include <LibWeb/Layout/SVGFormattingContext.h>
 #include <LibWeb/Layout/SVGGeometryBox.h>
@@ -176,6 +177,7 @@ void SVGFormattingContext::run(AvailableSpace const& available_space)
 {
     // NOTE: SVG doesn't have a "formatting context" in the spec, but this is the most
     //       obvious way to drive SVG layout in our engine at the moment.
+    LayoutTraceScope trace_scope { *this };
 
     auto const& svg_viewport = as<SVG::SVGViewport>(*context_box().dom_node());
     auto& svg_box_state = m_state.get_mutable(context_box());
@@ -10,6 +10,7 @@
 #include <LibWeb/Layout/BlockFormattingContext.h>
 #include <LibWeb/Layout/Box.h>
 #include <LibWeb/Layout/InlineFormattingContext.h>
+#include <LibWeb/Layout/LayoutTrace.h>
 #include <LibWeb/Layout/TableFormattingContext.h>
 
 namespace Web::Layout {
@@ -106,6 +107,7 @@ void TableFormattingContext::compute_cell_measures()
 
     compute_constrainedness();
 
+    auto is_in_fixed_mode = use_fixed_mode_layout();
     for (auto& cell : m_cells) {
         auto const& computed_values = cell.box->computed_values();
         CSSPixels padding_top = computed_values.padding().top().to_px(cell.box, containing_block.content_height());
@@ -121,14 +123,27 @@ void TableFormattingContext::compute_cell_measures()
         CSSPixels border_left = use_collapsing_borders_model ? round(cell_state.border_left / 2) : computed_values.border_left().width;
         CSSPixels border_right = use_collapsing_borders_model ? round(cell_state.border_right / 2) : computed_values.border_right().width;
 
+        auto min_height = computed_values.min_height().to_px(cell.box, containing_block.content_height());
+        auto cell_intrinsic_height_offsets = padding_top + padding_bottom + border_top + border_bottom;
+        auto width_is_specified_length_or_percentage = computed_values.width().is_length() || computed_values.width().is_percentage();
+
+        // OPTIMIZATION: In fixed mode, only the cells in the first row contribute to the widths of the columns, and the
+        //               rows are sized by laying out their cells at the final column widths in compute_table_height().
+        //               Measuring the contents of any other cell is wasted work, which dominates the layout of tables
+        //               with many rows. Cells spanning several rows are still measured, as their heights are distributed
+        //               to the rows they span.
+        if (is_in_fixed_mode && cell.row_index != 0 && cell.row_span == 1 && !width_is_specified_length_or_percentage) {
+            cell.outer_min_height = min_height + cell_intrinsic_height_offsets;
+            cell.outer_max_height = cell.outer_min_height;
+            continue;
+        }
+
         auto min_content_width = calculate_min_content_width(cell.box);
         auto max_content_width = calculate_max_content_width(cell.box);
         auto min_content_height = calculate_min_content_height(cell.box, max_content_width);
         auto max_content_height = calculate_max_content_height(cell.box, min_content_width);
 
         // The outer min-content height of a table-cell is max(min-height, min-content height) adjusted by the cell intrinsic offsets.
-        auto min_height = computed_values.min_height().to_px(cell.box, containing_block.content_height());
-        auto cell_intrinsic_height_offsets = padding_top + padding_bottom + border_top + border_bottom;
         cell.outer_min_height = max(min_height, min_content_height) + cell_intrinsic_height_offsets;
         // The outer min-content width of a table-cell is max(min-width, min-content width) adjusted by the cell intrinsic offsets.
         auto min_width = computed_values.min_width().to_px(cell.box, containing_block.content_width());
@@ -136,8 +151,7 @@ void TableFormattingContext::compute_cell_measures()
         // For fixed mode, according to https://www.w3.org/TR/css-tables-3/#computing-column-measures:
         // The min-content and max-content width of cells is considered zero unless they are directly specified as a length-percentage,
         // in which case they are resolved based on the table width (if it is definite, otherwise use 0).
-        auto width_is_specified_length_or_percentage = computed_values.width().is_length() || computed_values.width().is_percentage();
-        if (!use_fixed_mode_layout() || width_is_specified_length_or_percentage) {
+        if (!is_in_fixed_mode || width_is_specified_length_or_percentage) {
             cell.outer_min_width = max(min_width, min_content_width) + cell_intrinsic_width_offsets;
         }
 
@@ -160,7 +174,7 @@ void TableFormattingContext::compute_cell_measures()
         // See the explanation for height and max_height above.
         auto width = computed_values.width().is_length() ? computed_values.width().to_px(cell.box, containing_block.content_width()) : 0;
         auto max_width = computed_values.max_width().is_length() ? computed_values.max_width().to_px(cell.box, containing_block.content_width()) : CSSPixels::max();
-        if (use_fixed_mode_layout() && !width_is_specified_length_or_percentage) {
+        if (is_in_fixed_mode && !width_is_specified_length_or_percentage) {
             continue;
         }
         if (m_columns[cell.column_index].is_constrained) {
@@ -1602,12 +1616,12 @@ Vector<TableFormattingContext::ConflictingEdge> TableFormattingContext::BorderCo
     return result;
 }
 
-void TableFormattingContext::finish_grid_initialization(TableGrid const& table_grid)
+void TableFormattingContext::finish_grid_initialization(size_t column_count)
 {
-    m_columns.resize(table_grid.column_count());
+    m_columns.resize(column_count);
     m_cells_by_coordinate.resize(m_rows.size());
     for (auto& position_to_cell_row : m_cells_by_coordinate) {
-        position_to_cell_row.resize(table_grid.column_count());
+        position_to_cell_row.resize(column_count);
     }
     for (auto const& cell : m_cells) {
         m_cells_by_coordinate[cell.row_index][cell.column_index] = cell;
@@ -1620,7 +1634,16 @@ void TableFormattingContext::run_until_width_calculation(AvailableSpace const& a
     m_available_space = available_space;
 
     // Determine the number of rows/columns the table requires.
-    finish_grid_initialization(TableGrid::calculate_row_column_grid(context_box(), m_cells, m_rows));
+    auto const* table_grid = table_box().cached_table_grid();
+    if (!table_grid) {
+        auto new_table_grid = make<CachedTableGrid>();
+        new_table_grid->column_count = TableGrid::calculate_row_column_grid(table_box(), new_table_grid->cells, new_table_grid->rows).column_count();
+        table_grid = new_table_grid.ptr();
+        table_box().set_cached_table_grid(move(new_table_grid));
+    }
+    m_cells = table_grid->cells;
+    m_rows = table_grid->rows;
+    finish_grid_initialization(table_grid->column_count);
 
     border_conflict_resolution();
 
@@ -1672,6 +1695,8 @@ void TableFormattingContext::parent_context_did_dimension_child_root_box()
 
 void TableFormattingContext::run(AvailableSpace const& available_space)
 {
+    LayoutTraceScope trace_scope { *this };
+
     m_available_space = available_space;
 
     auto total_captions_height = run_caption_layout(CSS::CaptionSide::Top);
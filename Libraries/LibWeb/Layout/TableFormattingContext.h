@@ -63,7 +63,7 @@ private:
     void border_conflict_resolution();
     CSSPixels border_spacing_horizontal() const;
     CSSPixels border_spacing_vertical() const;
-    void finish_grid_initialization(TableGrid const&);
+    void finish_grid_initialization(size_t column_count);
 
     CSSPixels compute_columns_total_used_width() const;
     void commit_candidate_column_widths(Vector<CSSPixels> const& candidate_widths);
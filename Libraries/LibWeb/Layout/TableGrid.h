@@ -86,6 +86,14 @@ private:
     HashMap<GridPosition, bool> m_occupancy_grid;
 };
 
+// The rows and cells of a table as formed by TableGrid::calculate_row_column_grid(). Forming them walks every row and
+// cell of the table, so the result is kept on the table box until its layout subtree changes.
+struct CachedTableGrid {
+    size_t column_count { 0 };
+    Vector<TableGrid::Cell> cells;
+    Vector<TableGrid::Row> rows;
+};
+
 }
 
 namespace AK {
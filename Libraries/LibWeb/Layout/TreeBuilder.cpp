@@ -8,6 +8,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/Optional.h>
 #include <AK/TemporaryChange.h>
 #include <LibWeb/CSS/ComputedProperties.h>
@@ -625,14 +626,22 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
 
     auto shadow_root = is<DOM::Element>(dom_node) ? as<DOM::Element>(dom_node).shadow_root() : nullptr;
 
-    auto element_has_content_visibility_hidden = [&dom_node]() {
-        if (is<DOM::Element>(dom_node)) {
-            auto& element = static_cast<DOM::Element&>(dom_node);
-            return element.computed_properties()->content_visibility() == CSS::ContentVisibility::Hidden;
-        }
-        return false;
+    auto element_skips_its_contents = [&dom_node]() {
+        auto* element = as_if<DOM::Element>(dom_node);
+        if (!element)
+            return false;
+        // NOTE: Until its proximity to the viewport has been determined, a content-visibility: auto element is laid out
+        //       with its contents, so that it has its real size in its first frame. The rendering loop rebuilds its
+        //       subtree once it knows whether the element is relevant to the user.
+        if (element->computed_properties()->content_visibility() == CSS::ContentVisibility::Auto
+            && element->proximity_to_the_viewport() == DOM::ProximityToTheViewport::NotDetermined)
+            return false;
+        return element->skips_its_contents();
     }();
 
+    if (auto* box = as_if<Box>(*layout_node); box && should_create_layout_node && box->can_have_children())
+        box->set_contents_are_skipped(element_skips_its_contents);
+
     auto prior_quote_nesting_level = m_quote_nesting_level;
 
     if (should_create_layout_node) {
@@ -642,11 +651,11 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
             CSS::resolve_counters(element_reference);
         }
 
-        update_layout_tree_before_children(dom_node, *layout_node, context, element_has_content_visibility_hidden);
+        update_layout_tree_before_children(dom_node, *layout_node, context, element_skips_its_contents);
     }
 
     if (should_create_layout_node || dom_node.child_needs_layout_tree_update()) {
-        if ((dom_node.has_children() || shadow_root) && layout_node->can_have_children() && !element_has_content_visibility_hidden) {
+        if ((dom_node.has_children() || shadow_root) && layout_node->can_have_children() && !element_skips_its_contents) {
             push_parent(as<NodeWithStyle>(*layout_node));
             if (shadow_root) {
                 for (auto* node = shadow_root->first_child(); node; node = node->next_sibling()) {
@@ -682,7 +691,7 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
     if (is<HTML::HTMLSlotElement>(dom_node)) {
         auto& slot_element = static_cast<HTML::HTMLSlotElement&>(dom_node);
 
-        if (slot_element.computed_properties()->content_visibility() != CSS::ContentVisibility::Hidden) {
+        if (!element_skips_its_contents) {
             auto slottables = slot_element.assigned_nodes_internal();
             push_parent(as<NodeWithStyle>(*layout_node));
 
@@ -699,7 +708,7 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
     }
 
     if (should_create_layout_node) {
-        update_layout_tree_after_children(dom_node, *layout_node, context, element_has_content_visibility_hidden);
+        update_layout_tree_after_children(dom_node, *layout_node, context, element_skips_its_contents);
         wrap_in_button_layout_tree_if_needed(dom_node, *layout_node);
 
         // If we completely finished inserting a block level element into an inline parent, we need to fix up the tree so
@@ -718,6 +727,9 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
         m_quote_nesting_level = prior_quote_nesting_level;
     }
 
+    if (should_create_layout_node && must_create_subtree == MustCreateSubtree::No)
+        m_rebuilt_subtree_roots.append(*layout_node);
+
     dom_node.set_needs_layout_tree_update(false, DOM::SetNeedsLayoutTreeUpdateReason::None);
     dom_node.set_child_needs_layout_tree_update(false);
 }
@@ -765,10 +777,10 @@ void TreeBuilder::wrap_in_button_layout_tree_if_needed(DOM::Node& dom_node, GC::
     }
 }
 
-void TreeBuilder::update_layout_tree_before_children(DOM::Node& dom_node, GC::Ref<Layout::Node> layout_node, TreeBuilder::Context&, bool element_has_content_visibility_hidden)
+void TreeBuilder::update_layout_tree_before_children(DOM::Node& dom_node, GC::Ref<Layout::Node> layout_node, TreeBuilder::Context&, bool element_skips_its_contents)
 {
     // Add node for the ::before pseudo-element.
-    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !element_has_content_visibility_hidden) {
+    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !element_skips_its_contents) {
         auto& element = static_cast<DOM::Element&>(dom_node);
         push_parent(as<NodeWithStyle>(*layout_node));
         create_pseudo_element_if_needed(element, CSS::PseudoElement::Before, AppendOrPrepend::Prepend);
@@ -776,7 +788,7 @@ void TreeBuilder::update_layout_tree_before_children(DOM::Node& dom_node, GC::Re
     }
 }
 
-void TreeBuilder::update_layout_tree_after_children(DOM::Node& dom_node, GC::Ref<Layout::Node> layout_node, TreeBuilder::Context& context, bool element_has_content_visibility_hidden)
+void TreeBuilder::update_layout_tree_after_children(DOM::Node& dom_node, GC::Ref<Layout::Node> layout_node, TreeBuilder::Context& context, bool element_skips_its_contents)
 {
     auto& document = dom_node.document();
     auto& style_computer = document.style_computer();
@@ -812,7 +824,7 @@ void TreeBuilder::update_layout_tree_after_children(DOM::Node& dom_node, GC::Ref
     }
 
     // Add nodes for the ::after pseudo-element.
-    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !element_has_content_visibility_hidden) {
+    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !element_skips_its_contents) {
         auto& element = static_cast<DOM::Element&>(dom_node);
         push_parent(as<NodeWithStyle>(*layout_node));
         create_pseudo_element_if_needed(element, CSS::PseudoElement::After, AppendOrPrepend::Append);
@@ -824,14 +836,32 @@ GC::Ptr<Layout::Node> TreeBuilder::build(DOM::Node& dom_node)
 {
     VERIFY(dom_node.is_document());
 
-    dom_node.document().style_computer().reset_ancestor_filter();
+    CSS::StyleComputer::AncestorFilterScope ancestor_filter_scope { dom_node.document().style_computer() };
 
     Context context;
     m_quote_nesting_level = 0;
+    m_rebuilt_subtree_roots.clear();
     update_layout_tree(dom_node, context, MustCreateSubtree::No);
 
-    if (auto* root = dom_node.document().layout_node())
-        fixup_tables(*root);
+    // Boxes that were left untouched have already been fixed up, so only the rebuilt subtrees need to be visited.
+    // That doesn't hold if a rebuilt subtree is itself a table part, or sits inside one, since fixing it up may then
+    // require wrapping it or its siblings.
+    auto is_part_of_table_structure = [](Node const& node) {
+        auto const* parent = node.parent();
+        return node.display().is_internal()
+            || (parent && (parent->display().is_internal() || parent->display().is_table_inside() || parent->is_table_wrapper()));
+    };
+    if (auto* root = dom_node.document().layout_node()) {
+        if (any_of(m_rebuilt_subtree_roots, [&](auto const& node) { return is_part_of_table_structure(*node); })) {
+            fixup_tables(*root);
+        } else {
+            for (auto& subtree_root : m_rebuilt_subtree_roots) {
+                if (auto* node_with_style = as_if<NodeWithStyle>(*subtree_root); node_with_style && (subtree_root->parent() || subtree_root.ptr() == root))
+                    fixup_tables(*node_with_style);
+            }
+        }
+    }
+    m_rebuilt_subtree_roots.clear();
 
     return m_layout_root;
 }
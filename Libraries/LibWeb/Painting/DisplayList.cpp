@@ -66,9 +66,10 @@ static bool command_is_clip_or_mask(DisplayListCommand const& command)
         });
 }
 
-void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, RefPtr<Gfx::PaintingSurface> surface)
+void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, RefPtr<Gfx::PaintingSurface> surface, AnimatedStackingContextsByDisplayList&& animated_stacking_contexts_by_display_list)
 {
     TemporaryChange change { m_scroll_state_snapshots_by_display_list, move(scroll_state_snapshot_by_display_list) };
+    TemporaryChange animated_stacking_contexts_change { m_animated_stacking_contexts_by_display_list, move(animated_stacking_contexts_by_display_list) };
     if (surface) {
         surface->lock_context();
     }
@@ -123,6 +124,8 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
 
     DevicePixelConverter device_pixel_converter { device_pixels_per_css_pixel };
 
+    auto animated_stacking_contexts = m_animated_stacking_contexts_by_display_list.get(display_list);
+
     VERIFY(!m_surfaces.is_empty());
 
     Vector<RefPtr<ClipFrame const>> clip_frames_stack;
@@ -146,6 +149,13 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
         // node.
         if (command.has<PushStackingContext>()) {
             clip_frames_stack.append({});
+            if (animated_stacking_contexts.has_value()) {
+                if (auto properties = animated_stacking_contexts->get(command_index); properties.has_value()) {
+                    auto& push_stacking_context = command.get<PushStackingContext>();
+                    push_stacking_context.opacity = properties->opacity;
+                    push_stacking_context.transform.matrix = properties->matrix;
+                }
+            }
         } else if (command.has<PopStackingContext>()) {
             if (auto clip_frame = clip_frames_stack.take_last()) {
                 remove_clip_frame(*clip_frame);
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AK/Forward.h>
+#include <AK/HashMap.h>
 #include <AK/NonnullRefPtr.h>
 #include <AK/SegmentedVector.h>
 #include <LibGfx/Color.h>
@@ -22,17 +23,27 @@
 
 namespace Web::Painting {
 
+// The opacity and transform of a stacking context as sampled from its running animations after its display list was
+// recorded. These replace the values in the stacking context's PushStackingContext command when the display list is
+// replayed, so animating them doesn't require recording a new display list for every frame.
+struct AnimatedStackingContextProperties {
+    float opacity;
+    Gfx::FloatMatrix4x4 matrix;
+};
+using AnimatedStackingContextPropertiesByCommandIndex = HashMap<size_t, AnimatedStackingContextProperties>;
+
 class DisplayListPlayer {
 public:
     virtual ~DisplayListPlayer() = default;
 
-    void execute(DisplayList&, ScrollStateSnapshotByDisplayList&&, RefPtr<Gfx::PaintingSurface>);
+    void execute(DisplayList&, ScrollStateSnapshotByDisplayList&&, RefPtr<Gfx::PaintingSurface>, AnimatedStackingContextsByDisplayList&& = {});
 
 protected:
     Gfx::PaintingSurface& surface() const { return m_surfaces.last(); }
     void execute_impl(DisplayList&, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface>);
 
     ScrollStateSnapshotByDisplayList m_scroll_state_snapshots_by_display_list;
+    AnimatedStackingContextsByDisplayList m_animated_stacking_contexts_by_display_list;
 
 private:
     virtual void flush() = 0;
@@ -97,6 +108,11 @@ public:
     AK::SegmentedVector<DisplayListCommandWithScrollAndClip, 512> const& commands() const { return m_commands; }
     double device_pixels_per_css_pixel() const { return m_device_pixels_per_css_pixel; }
 
+    // NOTE: The boxes are only used as keys, and only by the thread that recorded the display list, to find the
+    //       PushStackingContext command of an animated stacking context.
+    void set_stacking_context_command_index(PaintableBox const& paintable_box, size_t command_index) { m_stacking_context_command_indices.set(&paintable_box, command_index); }
+    Optional<size_t> stacking_context_command_index(PaintableBox const& paintable_box) const { return m_stacking_context_command_indices.get(&paintable_box); }
+
     String dump() const;
 
 private:
@@ -106,6 +122,7 @@ private:
     }
 
     AK::SegmentedVector<DisplayListCommandWithScrollAndClip, 512> m_commands;
+    HashMap<PaintableBox const*, size_t> m_stacking_context_command_indices;
     double m_device_pixels_per_css_pixel;
 };
 
@@ -305,6 +305,8 @@ void DisplayListRecorder::push_stacking_context(PushStackingContextParams params
             .matrix = params.transform.matrix,
         },
         .clip_path = params.clip_path });
+    if (params.paintable_box)
+        m_display_list.set_stacking_context_command_index(*params.paintable_box, m_display_list.commands().size() - 1);
     m_clip_frame_stack.append({});
 }
 
@@ -106,6 +106,8 @@ public:
         bool isolate;
         StackingContextTransform transform;
         Optional<Gfx::Path> clip_path = {};
+        // The box that established the stacking context, so it can later be looked up in the display list.
+        PaintableBox const* paintable_box = nullptr;
     };
     void push_stacking_context(PushStackingContextParams params);
     void pop_stacking_context();
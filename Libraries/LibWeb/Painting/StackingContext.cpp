@@ -299,6 +299,14 @@ static Gfx::FloatMatrix4x4 matrix_with_scaled_translation(Gfx::FloatMatrix4x4 ma
     return matrix;
 }
 
+AnimatedStackingContextProperties StackingContext::animated_properties(double device_pixels_per_css_pixel) const
+{
+    return {
+        .opacity = paintable_box().computed_values().opacity(),
+        .matrix = matrix_with_scaled_translation(paintable_box().transform(), float(device_pixels_per_css_pixel)),
+    };
+}
+
 void StackingContext::paint(DisplayListRecordingContext& context) const
 {
     auto opacity = paintable_box().computed_values().opacity();
@@ -336,6 +344,7 @@ void StackingContext::paint(DisplayListRecordingContext& context) const
         auto device_pixel_scale = context.device_pixels_per_css_pixel();
         push_stacking_context_params.clip_path = path.copy_transformed(Gfx::AffineTransform {}.set_scale(device_pixel_scale, device_pixel_scale).set_translation(source_paintable_rect.location().to_type<float>()));
     }
+    push_stacking_context_params.paintable_box = &paintable_box();
 
     auto has_css_transform = paintable_box().has_css_transform();
     if (has_css_transform) {
@@ -40,6 +40,10 @@ public:
 
     Gfx::AffineTransform affine_transform_matrix() const;
 
+    // The opacity and transform that paint() records for this stacking context, for replaying an already recorded
+    // display list after they have been animated.
+    AnimatedStackingContextProperties animated_properties(double device_pixels_per_css_pixel) const;
+
     void dump(StringBuilder&, int indent = 0) const;
 
     void sort();
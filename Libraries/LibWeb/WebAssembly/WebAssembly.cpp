@@ -9,6 +9,7 @@
 #include <AK/MemoryStream.h>
 #include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
+#include <LibCrypto/Hash/SHA2.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/BigInt.h>
@@ -52,6 +53,46 @@ WebAssemblyCache& get_cache(JS::Realm& realm)
     return s_caches.ensure(realm.global_object());
 }
 
+CompiledModuleCache& CompiledModuleCache::the()
+{
+    static CompiledModuleCache cache;
+    return cache;
+}
+
+ByteString CompiledModuleCache::key_for(ReadonlyBytes bytes)
+{
+    auto digest = ::Crypto::Hash::SHA256::hash(bytes);
+    return ByteString(digest.bytes());
+}
+
+RefPtr<Wasm::Module> CompiledModuleCache::get(ByteString const& key)
+{
+    auto entry = m_entries.get(key);
+    if (!entry.has_value())
+        return nullptr;
+
+    m_entries_by_last_use.remove(**entry);
+    m_entries_by_last_use.append(**entry);
+    return (*entry)->module;
+}
+
+void CompiledModuleCache::set(ByteString key, NonnullRefPtr<Wasm::Module> module, size_t byte_size)
+{
+    if (byte_size > maximum_total_byte_size || m_entries.contains(key))
+        return;
+
+    while (m_total_byte_size + byte_size > maximum_total_byte_size) {
+        auto* least_recently_used_entry = m_entries_by_last_use.take_first();
+        m_total_byte_size -= least_recently_used_entry->byte_size;
+        m_entries.remove(least_recently_used_entry->key);
+    }
+
+    m_total_byte_size += byte_size;
+    auto entry = make<Entry>(key, move(module), byte_size);
+    m_entries_by_last_use.append(*entry);
+    m_entries.set(move(key), move(entry));
+}
+
 }
 
 void visit_edges(JS::Object& object, JS::Cell::Visitor& visitor)
@@ -422,16 +463,27 @@ JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> compile_a_webass
 {
     TRY(host_ensure_can_compile_wasm_bytes(vm));
 
+    auto& cache = get_cache(*vm.current_realm());
+    auto& compiled_module_cache = CompiledModuleCache::the();
+    auto key = CompiledModuleCache::key_for(data.bytes());
+
+    if (auto module = compiled_module_cache.get(key)) {
+        auto compiled_module = make_ref_counted<CompiledWebAssemblyModule>(module.release_nonnull());
+        cache.add_compiled_module(compiled_module);
+        return compiled_module;
+    }
+
     FixedMemoryStream stream { data.bytes() };
     auto module_result = Wasm::Module::parse(stream);
     if (module_result.is_error()) {
         return vm.throw_completion<CompileError>(Wasm::parse_error_to_byte_string(module_result.error()));
     }
 
-    auto& cache = get_cache(*vm.current_realm());
     if (auto validation_result = cache.abstract_machine().validate(module_result.value()); validation_result.is_error()) {
         return vm.throw_completion<CompileError>(validation_result.error().error_string);
     }
+    compiled_module_cache.set(move(key), module_result.value(), data.size());
+
     auto compiled_module = make_ref_counted<CompiledWebAssemblyModule>(module_result.release_value());
     cache.add_compiled_module(compiled_module);
     return compiled_module;
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AK/IntrusiveList.h>
 #include <AK/Optional.h>
 #include <LibGC/Root.h>
 #include <LibJS/Forward.h>
@@ -42,6 +43,41 @@ struct CompiledWebAssemblyModule : public RefCounted<CompiledWebAssemblyModule>
     NonnullRefPtr<Wasm::Module> module;
 };
 
+// Validated modules are never mutated again, so all realms in this process can share a single compiled module for
+// identical bytes. This spares re-parsing, re-validating and re-compiling the same binaries on every navigation.
+class CompiledModuleCache {
+public:
+    static CompiledModuleCache& the();
+
+    static ByteString key_for(ReadonlyBytes);
+
+    RefPtr<Wasm::Module> get(ByteString const& key);
+    void set(ByteString key, NonnullRefPtr<Wasm::Module>, size_t byte_size);
+
+private:
+    // Keep at most this many bytes worth of (binary) modules alive, evicting the least recently used ones first.
+    static constexpr size_t maximum_total_byte_size = 64 * MiB;
+
+    struct Entry {
+        Entry(ByteString key, NonnullRefPtr<Wasm::Module> module, size_t byte_size)
+            : key(move(key))
+            , module(move(module))
+            , byte_size(byte_size)
+        {
+        }
+
+        ByteString key;
+        NonnullRefPtr<Wasm::Module> module;
+        size_t byte_size { 0 };
+
+        IntrusiveListNode<Entry> list_node;
+    };
+
+    HashMap<ByteString, NonnullOwnPtr<Entry>> m_entries;
+    IntrusiveList<&Entry::list_node> m_entries_by_last_use;
+    size_t m_total_byte_size { 0 };
+};
+
 class WebAssemblyCache {
 public:
     void add_compiled_module(NonnullRefPtr<CompiledWebAssemblyModule> module) { m_compiled_modules.append(module); }
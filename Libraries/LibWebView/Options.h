@@ -137,6 +137,11 @@ enum class PaintViewportScrollbars {
     No,
 };
 
+enum class EnableParallelLayout {
+    No,
+    Yes,
+};
+
 struct WebContentOptions {
     String command_line;
     String executable_path;
@@ -154,6 +159,7 @@ struct WebContentOptions {
     CollectGarbageOnEveryAllocation collect_garbage_on_every_allocation { CollectGarbageOnEveryAllocation::No };
     Optional<u16> echo_server_port {};
     PaintViewportScrollbars paint_viewport_scrollbars { PaintViewportScrollbars::Yes };
+    EnableParallelLayout enable_parallel_layout { EnableParallelLayout::No };
 };
 
 }
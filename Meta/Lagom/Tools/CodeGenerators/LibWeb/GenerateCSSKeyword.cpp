@@ -51,6 +51,7 @@ ErrorOr<void> generate_header_file(JsonArray& keyword_data, Core::File& file)
     StringBuilder builder;
     SourceGenerator generator { builder };
     generator.set("keyword_underlying_type", underlying_type_for_enum(keyword_data.size()));
+    generator.set("last_keyword", keyword_name(keyword_data.at(keyword_data.size() - 1).as_string()));
     generator.append(R"~~~(
 #pragma once
 
@@ -75,6 +76,8 @@ enum class Keyword : @keyword_underlying_type@ {
     generator.append(R"~~~(
 };
 
+constexpr Keyword last_keyword = Keyword::@last_keyword@;
+
 Optional<Keyword> keyword_from_string(StringView);
 StringView string_from_keyword(Keyword);
 
@@ -12,6 +12,9 @@
 #include <AK/JsonObject.h>
 #include <AK/QuickSort.h>
 #include <LibCore/EventLoop.h>
+#include <LibCore/File.h>
+#include <LibCore/StandardPaths.h>
+#include <LibCore/System.h>
 #include <LibGC/Heap.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/Font/FontDatabase.h>
@@ -284,6 +287,34 @@ void ConnectionFromClient::debug_request(u64 page_id, ByteString request, ByteSt
         return;
     }
 
+    if (request == "layout-trace") {
+        auto* document = page->page().top_level_browsing_context().active_document();
+        if (!document)
+            return;
+
+        if (argument == "on") {
+            document->start_layout_trace();
+            return;
+        }
+
+        auto trace = document->stop_layout_trace();
+        if (trace.is_empty())
+            return;
+
+        // The trace is written as Chrome trace event JSON, which can be loaded into chrome://tracing or Perfetto.
+        auto path = ByteString::formatted("{}/layout-trace-{}.json", Core::StandardPaths::tempfile_directory(), Core::System::getpid());
+        auto result = [&]() -> ErrorOr<void> {
+            auto file = TRY(Core::File::open(path, Core::File::OpenMode::Write));
+            TRY(file->write_until_depleted(trace.bytes()));
+            return {};
+        }();
+        if (result.is_error())
+            dbgln("Unable to write layout trace to {}: {}", path, result.error());
+        else
+            dbgln("Wrote layout trace to {}", path);
+        return;
+    }
+
     if (request == "dump-paint-tree") {
         if (auto* doc = page->page().top_level_browsing_context().active_document()) {
             if (auto* paintable = doc->paintable())
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Utf16View.h>
+#include <AK/Utf8View.h>
+#include <LibCore/MappedFile.h>
+#include <LibGfx/Font/Font.h>
+#include <LibGfx/Font/WOFF2/Loader.h>
+#include <LibGfx/TextLayout.h>
+#include <LibTest/TestCase.h>
+
+#define TEST_INPUT(x) ("test-inputs/" x)
+
+static void expect_same_glyphs(Gfx::GlyphRun const& a, Gfx::GlyphRun const& b)
+{
+    EXPECT_EQ(a.width(), b.width());
+    EXPECT_EQ(a.glyphs().size(), b.glyphs().size());
+    for (size_t i = 0; i < min(a.glyphs().size(), b.glyphs().size()); ++i) {
+        EXPECT_EQ(a.glyphs()[i].glyph_id, b.glyphs()[i].glyph_id);
+        EXPECT_EQ(a.glyphs()[i].position, b.glyphs()[i].position);
+        EXPECT_EQ(a.glyphs()[i].length_in_code_units, b.glyphs()[i].length_in_code_units);
+    }
+}
+
+TEST_CASE(reshaping_text_returns_independent_glyph_runs)
+{
+    auto file = MUST(Core::MappedFile::map(TEST_INPUT("woff2/incorrect_sfnt_size.woff2"sv)));
+    auto typeface = TRY_OR_FAIL(WOFF2::try_load_from_bytes(file->bytes()));
+    auto font = typeface->font(16);
+
+    auto first_run = Gfx::shape_text({ 0, 0 }, 0, Utf8View("abc"sv), *font, Gfx::GlyphRun::TextType::Ltr, {});
+    auto second_run = Gfx::shape_text({ 0, 0 }, 0, Utf8View("abc"sv), *font, Gfx::GlyphRun::TextType::Ltr, {});
+    EXPECT_NE(first_run.ptr(), second_run.ptr());
+    expect_same_glyphs(*first_run, *second_run);
+
+    // Layout appends glyphs to the runs it's handed, which must not leak into runs shaped later on.
+    first_run->glyphs().append({});
+    auto third_run = Gfx::shape_text({ 0, 0 }, 0, Utf8View("abc"sv), *font, Gfx::GlyphRun::TextType::Ltr, {});
+    expect_same_glyphs(*second_run, *third_run);
+
+    auto utf16_run = Gfx::shape_text({ 0, 0 }, 0, Utf16View(u"abc", 3), *font, Gfx::GlyphRun::TextType::Ltr, {});
+    expect_same_glyphs(*second_run, *utf16_run);
+}
+
+TEST_CASE(shaping_settings_are_not_mixed_up)
+{
+    auto file = MUST(Core::MappedFile::map(TEST_INPUT("woff2/incorrect_sfnt_size.woff2"sv)));
+    auto typeface = TRY_OR_FAIL(WOFF2::try_load_from_bytes(file->bytes()));
+    auto font = typeface->font(16);
+
+    auto run = Gfx::shape_text({ 0, 0 }, 0, Utf8View("ab"sv), *font, Gfx::GlyphRun::TextType::Ltr, {});
+    auto spaced_run = Gfx::shape_text({ 0, 0 }, 10, Utf8View("ab"sv), *font, Gfx::GlyphRun::TextType::Ltr, {});
+    EXPECT_APPROXIMATE(spaced_run->width(), run->width() + 20);
+
+    auto offset_run = Gfx::shape_text({ 5, 0 }, 0, Utf8View("ab"sv), *font, Gfx::GlyphRun::TextType::Ltr, {});
+    EXPECT_APPROXIMATE(offset_run->width(), run->width());
+    EXPECT_APPROXIMATE(offset_run->glyphs().first().position.x(), run->glyphs().first().position.x() + 5);
+
+    auto larger_font = typeface->font(32);
+    auto larger_run = Gfx::shape_text({ 0, 0 }, 0, Utf8View("ab"sv), *larger_font, Gfx::GlyphRun::TextType::Ltr, {});
+    EXPECT(&larger_run->font() == larger_font.ptr());
+}
+
+TEST_CASE(cached_glyphs_are_moved_to_the_baseline_start)
+{
+    auto file = MUST(Core::MappedFile::map(TEST_INPUT("woff2/incorrect_sfnt_size.woff2"sv)));
+    auto typeface = TRY_OR_FAIL(WOFF2::try_load_from_bytes(file->bytes()));
+    auto font = typeface->font(16);
+
+    auto run = Gfx::shape_text({ 0, 0 }, 0, Utf8View("xyz"sv), *font, Gfx::GlyphRun::TextType::Ltr, {});
+    auto lower_run = Gfx::shape_text({ 0, 7 }, 0, Utf8View("xyz"sv), *font, Gfx::GlyphRun::TextType::Ltr, {});
+    auto moved_run = Gfx::shape_text({ 3, 11 }, 0, Utf8View("xyz"sv), *font, Gfx::GlyphRun::TextType::Ltr, {});
+    EXPECT_EQ(lower_run->glyphs().size(), run->glyphs().size());
+    EXPECT_EQ(moved_run->glyphs().size(), run->glyphs().size());
+    for (size_t i = 0; i < min(run->glyphs().size(), min(lower_run->glyphs().size(), moved_run->glyphs().size())); ++i) {
+        EXPECT_APPROXIMATE(lower_run->glyphs()[i].position.x(), run->glyphs()[i].position.x());
+        EXPECT_APPROXIMATE(lower_run->glyphs()[i].position.y(), run->glyphs()[i].position.y() + 7);
+        EXPECT_APPROXIMATE(moved_run->glyphs()[i].position.x(), run->glyphs()[i].position.x() + 3);
+        EXPECT_APPROXIMATE(moved_run->glyphs()[i].position.y(), run->glyphs()[i].position.y() + 11);
+    }
+}
+
+TEST_CASE(cached_glyphs_do_not_keep_fonts_alive)
+{
+    auto file = MUST(Core::MappedFile::map(TEST_INPUT("woff2/incorrect_sfnt_size.woff2"sv)));
+    auto typeface = TRY_OR_FAIL(WOFF2::try_load_from_bytes(file->bytes()));
+
+    // NOTE: Typefaces keep the fonts they hand out alive, so we create fonts of our own.
+    auto font = adopt_ref(*new Gfx::Font(typeface, 20, 20));
+    (void)Gfx::shape_text({ 0, 0 }, 0, Utf8View("font"sv), *font, Gfx::GlyphRun::TextType::Ltr, {});
+    EXPECT_EQ(font->ref_count(), 1u);
+}
@@ -0,0 +1,397 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <AK/Random.h>
+#include <AK/Vector.h>
+#include <LibTest/TestCase.h>
+#include <LibWasm/AbstractMachine/Operators.h>
+#include <math.h>
+
+using namespace Wasm;
+
+// The lane-by-lane loops here are what the vector operators fall back to when an operator has no native vector form,
+// so comparing against them both checks that the native path computes the same thing and shows how much faster it is.
+
+template<size_t VectorSize, typename Op, template<typename> typename SetSign>
+static u128 scalar_integer_binary_op(u128 lhs, u128 rhs)
+{
+    using VectorType = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
+    auto first = bit_cast<VectorType>(lhs);
+    auto second = bit_cast<VectorType>(rhs);
+    VectorType result;
+    Op op;
+    for (size_t i = 0; i < VectorSize; ++i)
+        result[i] = op(first[i], second[i]);
+    return bit_cast<u128>(result);
+}
+
+template<size_t VectorSize, typename Op, template<typename> typename SetSign>
+static u128 scalar_integer_cmp_op(u128 lhs, u128 rhs)
+{
+    using ElementType = NativeIntegralType<128 / VectorSize>;
+    using VectorType = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
+    auto first = bit_cast<VectorType>(lhs);
+    auto second = bit_cast<VectorType>(rhs);
+    Native128ByteVectorOf<ElementType, MakeUnsigned> result;
+    Op op;
+    for (size_t i = 0; i < VectorSize; ++i)
+        result[i] = op(first[i], second[i]) ? static_cast<ElementType>(-1) : 0;
+    return bit_cast<u128>(result);
+}
+
+template<size_t VectorSize, typename Op>
+static u128 scalar_float_binary_op(u128 lhs, u128 rhs)
+{
+    using VectorType = NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>;
+    auto first = bit_cast<VectorType>(lhs);
+    auto second = bit_cast<VectorType>(rhs);
+    VectorType result;
+    Op op;
+    for (size_t i = 0; i < VectorSize; ++i)
+        result[i] = op(first[i], second[i]);
+    return bit_cast<u128>(result);
+}
+
+// The operators below have no lane-by-lane fallback to compare against, so these references spell out what the spec
+// says each lane of the result is, using plain arrays rather than vector types.
+
+template<typename T>
+using Lanes = Array<T, sizeof(u128) / sizeof(T)>;
+
+template<typename T>
+static Lanes<T> lanes_of(u128 value)
+{
+    return bit_cast<Lanes<T>>(value);
+}
+
+template<typename T, typename Op>
+static u128 scalar_unary_op(u128 value)
+{
+    auto lanes = lanes_of<T>(value);
+    Op op;
+    for (auto& lane : lanes)
+        lane = static_cast<T>(op(lane));
+    return bit_cast<u128>(lanes);
+}
+
+static u128 scalar_shuffle(u128 lhs, u128 rhs, u128 lanes)
+{
+    auto first = lanes_of<u8>(lhs);
+    auto second = lanes_of<u8>(rhs);
+    auto control = lanes_of<u8>(lanes);
+    Lanes<u8> result;
+    for (size_t i = 0; i < result.size(); ++i)
+        result[i] = control[i] < 16 ? first[control[i]] : second[control[i] - 16];
+    return bit_cast<u128>(result);
+}
+
+template<typename Wide, typename Narrow>
+static u128 scalar_narrow(u128 lhs, u128 rhs)
+{
+    auto first = lanes_of<Wide>(lhs);
+    auto second = lanes_of<Wide>(rhs);
+    Lanes<Narrow> result;
+    for (size_t i = 0; i < first.size(); ++i) {
+        result[i] = static_cast<Narrow>(clamp<Wide>(first[i], NumericLimits<Narrow>::min(), NumericLimits<Narrow>::max()));
+        result[first.size() + i] = static_cast<Narrow>(clamp<Wide>(second[i], NumericLimits<Narrow>::min(), NumericLimits<Narrow>::max()));
+    }
+    return bit_cast<u128>(result);
+}
+
+static u128 scalar_dot(u128 lhs, u128 rhs)
+{
+    auto first = lanes_of<i16>(lhs);
+    auto second = lanes_of<i16>(rhs);
+    Lanes<i32> result;
+    for (size_t i = 0; i < result.size(); ++i) {
+        i32 even = first[i * 2] * second[i * 2];
+        i32 odd = first[i * 2 + 1] * second[i * 2 + 1];
+        // Only the sum of two products of -32768 overflows, and it wraps around.
+        result[i] = static_cast<i32>(static_cast<u32>(even) + static_cast<u32>(odd));
+    }
+    return bit_cast<u128>(result);
+}
+
+template<typename Narrow, typename Wide, Operators::VectorExt Mode>
+static u128 scalar_extmul(u128 lhs, u128 rhs)
+{
+    auto first = lanes_of<Narrow>(lhs);
+    auto second = lanes_of<Narrow>(rhs);
+    Lanes<Wide> result;
+    size_t offset = Mode == Operators::VectorExt::High ? result.size() : 0;
+    for (size_t i = 0; i < result.size(); ++i)
+        result[i] = static_cast<Wide>(static_cast<Wide>(first[offset + i]) * static_cast<Wide>(second[offset + i]));
+    return bit_cast<u128>(result);
+}
+
+template<typename Narrow, typename Wide>
+static u128 scalar_extadd_pairwise(u128 value)
+{
+    auto lanes = lanes_of<Narrow>(value);
+    Lanes<Wide> result;
+    for (size_t i = 0; i < result.size(); ++i)
+        result[i] = static_cast<Wide>(static_cast<Wide>(lanes[i * 2]) + static_cast<Wide>(lanes[i * 2 + 1]));
+    return bit_cast<u128>(result);
+}
+
+template<typename Input, typename Result>
+static u128 scalar_convert(u128 value)
+{
+    auto lanes = lanes_of<Input>(value);
+    // Lanes that have no input lane to convert are zeroed.
+    Lanes<Result> result {};
+    for (size_t i = 0; i < min(lanes.size(), result.size()); ++i)
+        result[i] = static_cast<Result>(lanes[i]);
+    return bit_cast<u128>(result);
+}
+
+template<typename Op>
+static u128 native_op(u128 lhs, u128 rhs)
+{
+    return Op {}(lhs, rhs);
+}
+
+template<typename Op>
+static u128 native_unary_op(u128 value)
+{
+    return Op {}(value);
+}
+
+static Vector<u128> const& random_vectors()
+{
+    static Vector<u128> vectors = [] {
+        Vector<u128> result;
+        result.resize(4096);
+        fill_with_random({ result.data(), result.size() * sizeof(u128) });
+        return result;
+    }();
+    return vectors;
+}
+
+template<typename T, size_t N>
+static void append_vectors_with_lanes(Vector<u128>& vectors, Array<T, N> const& values)
+{
+    // Every value ends up in every lane of one of the vectors.
+    for (size_t offset = 0; offset < N; ++offset) {
+        Lanes<T> lanes;
+        for (size_t i = 0; i < lanes.size(); ++i)
+            lanes[i] = values[(offset + i) % N];
+        vectors.append(bit_cast<u128>(lanes));
+    }
+}
+
+// Random lanes are unlikely to hit the edges of each lane type, or NaN, so these vectors are made of nothing else.
+static Vector<u128> const& edge_case_vectors()
+{
+    static Vector<u128> vectors = [] {
+        Vector<u128> result;
+        append_vectors_with_lanes(result, Array<u8, 8> { 0, 1, 0x7f, 0x80, 0x81, 0xfe, 0xff, 0x55 });
+        append_vectors_with_lanes(result, Array<u16, 9> { 0, 1, 0x7f, 0x80, 0xff, 0x7fff, 0x8000, 0x8001, 0xffff });
+        append_vectors_with_lanes(result, Array<u32, 9> { 0, 1, 0x7fff, 0x8000, 0xffff, 0x7fffffff, 0x80000000, 0x80000001, 0xffffffff });
+        append_vectors_with_lanes(result, Array<u64, 7> { 0, 1, 0x7fffffff, 0x80000000, 0x7fffffffffffffff, 0x8000000000000000, 0xffffffffffffffff });
+        append_vectors_with_lanes(result, Array<float, 16> { 0.0f, -0.0f, 0.5f, -0.5f, 1.5f, 2.5f, -2.5f, 8388607.5f, AK::NaN<float>, -AK::NaN<float>, AK::Infinity<float>, -AK::Infinity<float>, NumericLimits<float>::max(), NumericLimits<float>::lowest(), NumericLimits<float>::min_denormal(), 2147483648.0f });
+        append_vectors_with_lanes(result, Array<double, 16> { 0.0, -0.0, 0.5, -0.5, 1.5, 2.5, -2.5, 4503599627370495.5, AK::NaN<double>, -AK::NaN<double>, AK::Infinity<double>, -AK::Infinity<double>, NumericLimits<double>::max(), NumericLimits<double>::lowest(), NumericLimits<double>::min_denormal(), 3.4028235677973366e38 });
+        return result;
+    }();
+    return vectors;
+}
+
+// Wasm lets arithmetic on NaN produce any NaN, so NaN lanes only have to both be NaN. Everything else, including the
+// sign of zero, has to match exactly.
+template<typename Lane>
+static bool have_same_lanes(u128 a, u128 b)
+{
+    if constexpr (IsFloatingPoint<Lane>) {
+        auto first = lanes_of<Lane>(a);
+        auto second = lanes_of<Lane>(b);
+        for (size_t i = 0; i < first.size(); ++i) {
+            if (isnan(first[i]) && isnan(second[i]))
+                continue;
+            using Bits = MakeUnsigned<NativeIntegralType<sizeof(Lane) * 8>>;
+            if (bit_cast<Bits>(first[i]) != bit_cast<Bits>(second[i]))
+                return false;
+        }
+        return true;
+    } else {
+        return a == b;
+    }
+}
+
+template<typename Lane, typename Function>
+static void expect_same_results(Function native, Function scalar)
+{
+    auto const& vectors = random_vectors();
+    for (size_t i = 0; i + 1 < vectors.size(); ++i)
+        EXPECT(have_same_lanes<Lane>(native(vectors[i], vectors[i + 1]), scalar(vectors[i], vectors[i + 1])));
+
+    auto const& edge_cases = edge_case_vectors();
+    for (auto lhs : edge_cases) {
+        for (auto rhs : edge_cases)
+            EXPECT(have_same_lanes<Lane>(native(lhs, rhs), scalar(lhs, rhs)));
+    }
+}
+
+template<typename Lane, typename Function>
+static void expect_same_unary_results(Function native, Function scalar)
+{
+    for (auto const* vectors : { &random_vectors(), &edge_case_vectors() }) {
+        for (auto value : *vectors)
+            EXPECT(have_same_lanes<Lane>(native(value), scalar(value)));
+    }
+}
+
+template<typename Function>
+static void run_benchmark(Function function)
+{
+    auto const& vectors = random_vectors();
+    u128 accumulator = 0;
+    for (size_t iteration = 0; iteration < 1000; ++iteration) {
+        for (size_t i = 0; i + 1 < vectors.size(); ++i)
+            accumulator ^= function(vectors[i], vectors[i + 1]);
+    }
+    AK::taint_for_optimizer(accumulator);
+}
+
+template<typename Function>
+static void run_unary_benchmark(Function function)
+{
+    auto const& vectors = random_vectors();
+    u128 accumulator = 0;
+    for (size_t iteration = 0; iteration < 1000; ++iteration) {
+        for (auto value : vectors)
+            accumulator ^= function(value);
+    }
+    AK::taint_for_optimizer(accumulator);
+}
+
+#define SIMD_BINARY_OP_CASES(name, lane, native_function, scalar_function)                 \
+    TEST_CASE(name##_matches_scalar)                                                       \
+    {                                                                                      \
+        expect_same_results<lane, u128 (*)(u128, u128)>(native_function, scalar_function); \
+    }                                                                                      \
+    BENCHMARK_CASE(name##_native)                                                          \
+    {                                                                                      \
+        run_benchmark(native_function);                                                    \
+    }                                                                                      \
+    BENCHMARK_CASE(name##_scalar)                                                          \
+    {                                                                                      \
+        run_benchmark(scalar_function);                                                    \
+    }
+
+#define SIMD_UNARY_OP_CASES(name, lane, native_function, scalar_function)                   \
+    TEST_CASE(name##_matches_scalar)                                                        \
+    {                                                                                       \
+        expect_same_unary_results<lane, u128 (*)(u128)>(native_function, scalar_function); \
+    }                                                                                       \
+    BENCHMARK_CASE(name##_native)                                                           \
+    {                                                                                       \
+        run_unary_benchmark(native_function);                                               \
+    }                                                                                       \
+    BENCHMARK_CASE(name##_scalar)                                                           \
+    {                                                                                       \
+        run_unary_benchmark(scalar_function);                                               \
+    }
+
+SIMD_BINARY_OP_CASES(i8x16_add, u128, (native_op<Operators::VectorIntegerBinaryOp<16, Operators::Add>>), (scalar_integer_binary_op<16, Operators::Add, MakeSigned>))
+SIMD_BINARY_OP_CASES(i16x8_mul, u128, (native_op<Operators::VectorIntegerBinaryOp<8, Operators::Multiply>>), (scalar_integer_binary_op<8, Operators::Multiply, MakeSigned>))
+SIMD_BINARY_OP_CASES(i32x4_add, u128, (native_op<Operators::VectorIntegerBinaryOp<4, Operators::Add>>), (scalar_integer_binary_op<4, Operators::Add, MakeSigned>))
+SIMD_BINARY_OP_CASES(i8x16_add_sat_s, u128, (native_op<Operators::VectorIntegerBinaryOp<16, Operators::SaturatingOp<i8, Operators::Add>, MakeSigned>>), (scalar_integer_binary_op<16, Operators::SaturatingOp<i8, Operators::Add>, MakeSigned>))
+SIMD_BINARY_OP_CASES(i8x16_sub_sat_u, u128, (native_op<Operators::VectorIntegerBinaryOp<16, Operators::SaturatingOp<u8, Operators::Subtract>, MakeUnsigned>>), (scalar_integer_binary_op<16, Operators::SaturatingOp<u8, Operators::Subtract>, MakeUnsigned>))
+SIMD_BINARY_OP_CASES(i16x8_q15mulr_sat_s, u128, (native_op<Operators::VectorIntegerBinaryOp<8, Operators::SaturatingOp<i16, Operators::Q15Mul>, MakeSigned>>), (scalar_integer_binary_op<8, Operators::SaturatingOp<i16, Operators::Q15Mul>, MakeSigned>))
+SIMD_BINARY_OP_CASES(i8x16_avgr_u, u128, (native_op<Operators::VectorIntegerBinaryOp<16, Operators::Average, MakeUnsigned>>), (scalar_integer_binary_op<16, Operators::Average, MakeUnsigned>))
+SIMD_BINARY_OP_CASES(i16x8_min_s, u128, (native_op<Operators::VectorIntegerBinaryOp<8, Operators::Minimum, MakeSigned>>), (scalar_integer_binary_op<8, Operators::Minimum, MakeSigned>))
+SIMD_BINARY_OP_CASES(i32x4_max_u, u128, (native_op<Operators::VectorIntegerBinaryOp<4, Operators::Maximum, MakeUnsigned>>), (scalar_integer_binary_op<4, Operators::Maximum, MakeUnsigned>))
+SIMD_BINARY_OP_CASES(i8x16_lt_u, u128, (native_op<Operators::VectorCmpOp<16, Operators::LessThan, MakeUnsigned>>), (scalar_integer_cmp_op<16, Operators::LessThan, MakeUnsigned>))
+SIMD_BINARY_OP_CASES(i32x4_gt_s, u128, (native_op<Operators::VectorCmpOp<4, Operators::GreaterThan, MakeSigned>>), (scalar_integer_cmp_op<4, Operators::GreaterThan, MakeSigned>))
+SIMD_BINARY_OP_CASES(f32x4_mul, float, (native_op<Operators::VectorFloatBinaryOp<4, Operators::Multiply>>), (scalar_float_binary_op<4, Operators::Multiply>))
+SIMD_BINARY_OP_CASES(f64x2_div, double, (native_op<Operators::VectorFloatBinaryOp<2, Operators::Divide>>), (scalar_float_binary_op<2, Operators::Divide>))
+
+SIMD_BINARY_OP_CASES(i8x16_narrow_i16x8_s, u128, (native_op<Operators::VectorNarrow<16, i8>>), (scalar_narrow<i16, i8>))
+SIMD_BINARY_OP_CASES(i8x16_narrow_i16x8_u, u128, (native_op<Operators::VectorNarrow<16, u8>>), (scalar_narrow<i16, u8>))
+SIMD_BINARY_OP_CASES(i16x8_narrow_i32x4_s, u128, (native_op<Operators::VectorNarrow<8, i16>>), (scalar_narrow<i32, i16>))
+SIMD_BINARY_OP_CASES(i16x8_narrow_i32x4_u, u128, (native_op<Operators::VectorNarrow<8, u16>>), (scalar_narrow<i32, u16>))
+SIMD_BINARY_OP_CASES(i32x4_dot_i16x8_s, u128, (native_op<Operators::VectorDotProduct<4>>), (scalar_dot))
+SIMD_BINARY_OP_CASES(i16x8_extmul_low_i8x16_s, u128, (native_op<Operators::VectorIntegerExtOp<8, Operators::Multiply, Operators::VectorExt::Low, MakeSigned>>), (scalar_extmul<i8, i16, Operators::VectorExt::Low>))
+SIMD_BINARY_OP_CASES(i16x8_extmul_high_i8x16_u, u128, (native_op<Operators::VectorIntegerExtOp<8, Operators::Multiply, Operators::VectorExt::High, MakeUnsigned>>), (scalar_extmul<u8, u16, Operators::VectorExt::High>))
+SIMD_BINARY_OP_CASES(i32x4_extmul_high_i16x8_s, u128, (native_op<Operators::VectorIntegerExtOp<4, Operators::Multiply, Operators::VectorExt::High, MakeSigned>>), (scalar_extmul<i16, i32, Operators::VectorExt::High>))
+SIMD_BINARY_OP_CASES(i32x4_extmul_low_i16x8_u, u128, (native_op<Operators::VectorIntegerExtOp<4, Operators::Multiply, Operators::VectorExt::Low, MakeUnsigned>>), (scalar_extmul<u16, u32, Operators::VectorExt::Low>))
+SIMD_BINARY_OP_CASES(i64x2_extmul_low_i32x4_s, u128, (native_op<Operators::VectorIntegerExtOp<2, Operators::Multiply, Operators::VectorExt::Low, MakeSigned>>), (scalar_extmul<i32, i64, Operators::VectorExt::Low>))
+SIMD_BINARY_OP_CASES(i64x2_extmul_high_i32x4_u, u128, (native_op<Operators::VectorIntegerExtOp<2, Operators::Multiply, Operators::VectorExt::High, MakeUnsigned>>), (scalar_extmul<u32, u64, Operators::VectorExt::High>))
+
+SIMD_UNARY_OP_CASES(i16x8_extadd_pairwise_i8x16_s, u128, (native_unary_op<Operators::VectorIntegerExtOpPairwise<8, Operators::Add, MakeSigned>>), (scalar_extadd_pairwise<i8, i16>))
+SIMD_UNARY_OP_CASES(i16x8_extadd_pairwise_i8x16_u, u128, (native_unary_op<Operators::VectorIntegerExtOpPairwise<8, Operators::Add, MakeUnsigned>>), (scalar_extadd_pairwise<u8, u16>))
+SIMD_UNARY_OP_CASES(i32x4_extadd_pairwise_i16x8_s, u128, (native_unary_op<Operators::VectorIntegerExtOpPairwise<4, Operators::Add, MakeSigned>>), (scalar_extadd_pairwise<i16, i32>))
+SIMD_UNARY_OP_CASES(i32x4_extadd_pairwise_i16x8_u, u128, (native_unary_op<Operators::VectorIntegerExtOpPairwise<4, Operators::Add, MakeUnsigned>>), (scalar_extadd_pairwise<u16, u32>))
+
+SIMD_UNARY_OP_CASES(f32x4_convert_i32x4_s, float, (native_unary_op<Operators::VectorConvertOp<4, 4, u32, i32, Operators::Convert<f32>>>), (scalar_convert<i32, float>))
+SIMD_UNARY_OP_CASES(f32x4_convert_i32x4_u, float, (native_unary_op<Operators::VectorConvertOp<4, 4, u32, u32, Operators::Convert<f32>>>), (scalar_convert<u32, float>))
+SIMD_UNARY_OP_CASES(f64x2_convert_low_i32x4_s, double, (native_unary_op<Operators::VectorConvertOp<2, 4, u64, i32, Operators::Convert<f64>>>), (scalar_convert<i32, double>))
+SIMD_UNARY_OP_CASES(f64x2_convert_low_i32x4_u, double, (native_unary_op<Operators::VectorConvertOp<2, 4, u64, u32, Operators::Convert<f64>>>), (scalar_convert<u32, double>))
+SIMD_UNARY_OP_CASES(f32x4_demote_f64x2_zero, float, (native_unary_op<Operators::VectorConvertOp<4, 2, u32, f64, Operators::Convert<f32>>>), (scalar_convert<double, float>))
+SIMD_UNARY_OP_CASES(f64x2_promote_low_f32x4, double, (native_unary_op<Operators::VectorConvertOp<2, 4, u64, f32, Operators::Convert<f64>>>), (scalar_convert<float, double>))
+
+SIMD_UNARY_OP_CASES(i8x16_abs, u128, (native_unary_op<Operators::VectorIntegerUnaryOp<16, Operators::Absolute>>), (scalar_unary_op<i8, Operators::Absolute>))
+SIMD_UNARY_OP_CASES(i8x16_neg, u128, (native_unary_op<Operators::VectorIntegerUnaryOp<16, Operators::Negate>>), (scalar_unary_op<i8, Operators::Negate>))
+SIMD_UNARY_OP_CASES(i8x16_popcnt, u128, (native_unary_op<Operators::VectorIntegerUnaryOp<16, Operators::PopCount>>), (scalar_unary_op<i8, Operators::PopCount>))
+SIMD_UNARY_OP_CASES(i16x8_abs, u128, (native_unary_op<Operators::VectorIntegerUnaryOp<8, Operators::Absolute>>), (scalar_unary_op<i16, Operators::Absolute>))
+SIMD_UNARY_OP_CASES(i16x8_neg, u128, (native_unary_op<Operators::VectorIntegerUnaryOp<8, Operators::Negate>>), (scalar_unary_op<i16, Operators::Negate>))
+SIMD_UNARY_OP_CASES(i32x4_abs, u128, (native_unary_op<Operators::VectorIntegerUnaryOp<4, Operators::Absolute>>), (scalar_unary_op<i32, Operators::Absolute>))
+SIMD_UNARY_OP_CASES(i64x2_abs, u128, (native_unary_op<Operators::VectorIntegerUnaryOp<2, Operators::Absolute>>), (scalar_unary_op<i64, Operators::Absolute>))
+SIMD_UNARY_OP_CASES(f32x4_abs, float, (native_unary_op<Operators::VectorFloatUnaryOp<4, Operators::Absolute>>), (scalar_unary_op<float, Operators::Absolute>))
+SIMD_UNARY_OP_CASES(f32x4_neg, float, (native_unary_op<Operators::VectorFloatUnaryOp<4, Operators::Negate>>), (scalar_unary_op<float, Operators::Negate>))
+SIMD_UNARY_OP_CASES(f64x2_abs, double, (native_unary_op<Operators::VectorFloatUnaryOp<2, Operators::Absolute>>), (scalar_unary_op<double, Operators::Absolute>))
+SIMD_UNARY_OP_CASES(f64x2_neg, double, (native_unary_op<Operators::VectorFloatUnaryOp<2, Operators::Negate>>), (scalar_unary_op<double, Operators::Negate>))
+
+SIMD_UNARY_OP_CASES(f32x4_ceil, float, (native_unary_op<Operators::VectorFloatUnaryOp<4, Operators::Ceil>>), (scalar_unary_op<float, Operators::Ceil>))
+SIMD_UNARY_OP_CASES(f32x4_floor, float, (native_unary_op<Operators::VectorFloatUnaryOp<4, Operators::Floor>>), (scalar_unary_op<float, Operators::Floor>))
+SIMD_UNARY_OP_CASES(f32x4_trunc, float, (native_unary_op<Operators::VectorFloatUnaryOp<4, Operators::Truncate>>), (scalar_unary_op<float, Operators::Truncate>))
+SIMD_UNARY_OP_CASES(f32x4_nearest, float, (native_unary_op<Operators::VectorFloatUnaryOp<4, Operators::NearbyIntegral>>), (scalar_unary_op<float, Operators::NearbyIntegral>))
+SIMD_UNARY_OP_CASES(f64x2_ceil, double, (native_unary_op<Operators::VectorFloatUnaryOp<2, Operators::Ceil>>), (scalar_unary_op<double, Operators::Ceil>))
+SIMD_UNARY_OP_CASES(f64x2_floor, double, (native_unary_op<Operators::VectorFloatUnaryOp<2, Operators::Floor>>), (scalar_unary_op<double, Operators::Floor>))
+SIMD_UNARY_OP_CASES(f64x2_trunc, double, (native_unary_op<Operators::VectorFloatUnaryOp<2, Operators::Truncate>>), (scalar_unary_op<double, Operators::Truncate>))
+SIMD_UNARY_OP_CASES(f64x2_nearest, double, (native_unary_op<Operators::VectorFloatUnaryOp<2, Operators::NearbyIntegral>>), (scalar_unary_op<double, Operators::NearbyIntegral>))
+
+#undef SIMD_BINARY_OP_CASES
+#undef SIMD_UNARY_OP_CASES
+
+static u128 shuffle_lanes_for(u128 value)
+{
+    // Shuffle lanes are validated to select one of the 32 lanes of the two operands.
+    auto lanes = lanes_of<u8>(value);
+    for (auto& lane : lanes)
+        lane &= 31;
+    return bit_cast<u128>(lanes);
+}
+
+TEST_CASE(i8x16_shuffle_matches_scalar)
+{
+    auto const& vectors = random_vectors();
+    for (size_t i = 0; i + 2 < vectors.size(); ++i) {
+        auto lanes = shuffle_lanes_for(vectors[i + 2]);
+        EXPECT_EQ(Operators::VectorShuffle {}(vectors[i], vectors[i + 1], lanes), scalar_shuffle(vectors[i], vectors[i + 1], lanes));
+    }
+
+    // Every lane selecting the same lane of either operand, from the first lane of the first to the last of the second.
+    for (u8 lane = 0; lane < 32; ++lane) {
+        Lanes<u8> control;
+        control.fill(lane);
+        auto lanes = bit_cast<u128>(control);
+        EXPECT_EQ(Operators::VectorShuffle {}(vectors[0], vectors[1], lanes), scalar_shuffle(vectors[0], vectors[1], lanes));
+    }
+}
+
+BENCHMARK_CASE(i8x16_shuffle_native)
+{
+    auto lanes = shuffle_lanes_for(random_vectors().last());
+    run_benchmark([lanes](u128 lhs, u128 rhs) { return Operators::VectorShuffle {}(lhs, rhs, lanes); });
+}
+
+BENCHMARK_CASE(i8x16_shuffle_scalar)
+{
+    auto lanes = shuffle_lanes_for(random_vectors().last());
+    run_benchmark([lanes](u128 lhs, u128 rhs) { return scalar_shuffle(lhs, rhs, lanes); });
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/MemoryStream.h>
+#include <AK/StackInfo.h>
+#include <LibTest/TestCase.h>
+#include <LibWasm/AbstractMachine/AbstractMachine.h>
+#include <LibWasm/AbstractMachine/BytecodeInterpreter.h>
+#include <LibWasm/AbstractMachine/Profiler.h>
+#include <LibWasm/Types.h>
+
+// (module
+//   (func $leaf nop)
+//   (func $mid call $leaf)
+//   (func (export "run") call $leaf call $leaf call $mid))
+// The name section names $leaf and $mid, so "run" is named after its export.
+// clang-format off
+static constexpr u8 module_bytes[] = {
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+    // Type section: (func)
+    0x01, 0x04, 0x01, 0x60, 0x00, 0x00,
+    // Function section: three functions of type 0
+    0x03, 0x04, 0x03, 0x00, 0x00, 0x00,
+    // Export section: "run" -> function 2
+    0x07, 0x07, 0x01, 0x03, 'r', 'u', 'n', 0x00, 0x02,
+    // Code section
+    0x0a, 0x13, 0x03,
+    0x03, 0x00, 0x01, 0x0b,
+    0x04, 0x00, 0x10, 0x00, 0x0b,
+    0x08, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x01, 0x0b,
+    // Custom "name" section with the function names subsection
+    0x00, 0x13, 0x04, 'n', 'a', 'm', 'e',
+    0x01, 0x0c, 0x02, 0x00, 0x04, 'l', 'e', 'a', 'f', 0x01, 0x03, 'm', 'i', 'd',
+};
+// clang-format on
+
+TEST_CASE(function_call_counts)
+{
+    FixedMemoryStream module_stream { ReadonlyBytes { module_bytes, sizeof(module_bytes) } };
+    auto module = TRY_OR_FAIL(Wasm::Module::parse(module_stream));
+
+    Wasm::AbstractMachine machine;
+    auto instance = TRY_OR_FAIL(machine.instantiate(*module, {}));
+
+    Optional<Wasm::FunctionAddress> run_address;
+    for (auto const& entry : instance->exports()) {
+        if (entry.name() == "run"sv)
+            run_address = *entry.value().get_pointer<Wasm::FunctionAddress>();
+    }
+    EXPECT(run_address.has_value());
+
+    StackInfo stack_info;
+    Wasm::BytecodeInterpreter interpreter { stack_info };
+    Wasm::Profiler profiler { 1 };
+    profiler.register_module(*module, *instance);
+
+    interpreter.set_profiler(&profiler);
+    profiler.enter_function(*run_address);
+    auto result = machine.invoke(interpreter, *run_address, {});
+    profiler.exit_function();
+    interpreter.set_profiler(nullptr);
+    EXPECT(!result.is_trap());
+
+    AllocatingMemoryStream output;
+    MUST(profiler.write_function_calls(output));
+    auto contents = MUST(output.read_until_eof());
+    auto lines = StringView { contents.bytes() }.split_view('\n');
+
+    // $leaf is called from two different stacks, and its calls are summed up over both of them.
+    EXPECT_EQ(lines.size(), 3u);
+    EXPECT(lines[0].starts_with("leaf 3 "sv));
+    EXPECT(lines[1].starts_with("mid 1 "sv));
+    EXPECT(lines[2].starts_with("run 1 "sv));
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Endian.h>
+#include <AK/MemoryStream.h>
+#include <LibTest/TestCase.h>
+#include <LibWasm/AbstractMachine/AbstractMachine.h>
+#include <LibWasm/AbstractMachine/Configuration.h>
+#include <LibWasm/Types.h>
+#include <LibWasm/Wasi.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// (module (memory 1))
+// clang-format off
+static constexpr u8 module_bytes[] = {
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+    // Memory section: one memory with a minimum of one page
+    0x05, 0x03, 0x01, 0x00, 0x01,
+};
+// clang-format on
+
+static constexpr u32 iovecs_address = 0;
+static constexpr u32 first_buffer_address = 64;
+static constexpr u32 second_buffer_address = 128;
+static constexpr u32 result_address = 256;
+
+static void write_u32(Bytes memory, u32 address, u32 value)
+{
+    LittleEndian<u32> little_endian_value = value;
+    ReadonlyBytes { &little_endian_value, sizeof(little_endian_value) }.copy_to(memory.slice(address));
+}
+
+static u32 read_u32(Bytes memory, u32 address)
+{
+    LittleEndian<u32> little_endian_value;
+    memory.slice(address, sizeof(little_endian_value)).copy_to(Bytes { &little_endian_value, sizeof(little_endian_value) });
+    return little_endian_value;
+}
+
+static u32 call(Wasm::Configuration& configuration, Wasm::Wasi::Implementation& implementation, StringView name, i64 offset)
+{
+    auto function = MUST(implementation.function_by_name(name));
+    // fd 0 is mapped to the file, and the two iovecs are at the start of memory.
+    Vector<Wasm::Value> arguments {
+        Wasm::Value { static_cast<i32>(0) },
+        Wasm::Value { static_cast<i32>(iovecs_address) },
+        Wasm::Value { static_cast<i32>(2) },
+        Wasm::Value { offset },
+        Wasm::Value { static_cast<i32>(result_address) },
+    };
+    auto result = function.function()(configuration, arguments);
+    VERIFY(!result.is_trap());
+    return result.values().first().to<u32>();
+}
+
+TEST_CASE(positional_io_with_multiple_iovecs)
+{
+    char filename[] = "/tmp/test-wasi-positional-io-XXXXXX";
+    int fd = mkstemp(filename);
+    EXPECT(fd >= 0);
+    EXPECT_EQ(write(fd, "0123456789", 10), 10);
+    EXPECT_EQ(lseek(fd, 2, SEEK_SET), 2);
+
+    FixedMemoryStream module_stream { ReadonlyBytes { module_bytes, sizeof(module_bytes) } };
+    auto module = Wasm::Module::parse(module_stream);
+    EXPECT(!module.is_error());
+
+    Wasm::AbstractMachine machine;
+    auto instance = machine.instantiate(*module.value(), {});
+    EXPECT(!instance.is_error());
+
+    Wasm::Configuration configuration { machine.store() };
+    auto memory = machine.store().get(Wasm::MemoryAddress { 0 })->data().bytes();
+
+    Wasm::Wasi::Implementation implementation({ .stdin_fd = fd });
+
+    write_u32(memory, iovecs_address, first_buffer_address);
+    write_u32(memory, iovecs_address + 4, 3);
+    write_u32(memory, iovecs_address + 8, second_buffer_address);
+    write_u32(memory, iovecs_address + 12, 4);
+
+    // Both buffers are written back to back, starting at the offset.
+    "abc"sv.bytes().copy_to(memory.slice(first_buffer_address));
+    "defg"sv.bytes().copy_to(memory.slice(second_buffer_address));
+    EXPECT_EQ(call(configuration, implementation, "fd_pwrite"sv, 4), 0u);
+    EXPECT_EQ(read_u32(memory, result_address), 7u);
+    EXPECT_EQ(lseek(fd, 0, SEEK_CUR), 2);
+
+    char contents[16] {};
+    EXPECT_EQ(pread(fd, contents, sizeof(contents), 0), 11);
+    EXPECT_EQ(StringView(contents, 11), "0123abcdefg"sv);
+
+    // The first buffer is filled before the second one, which is only filled partially at the end of the file.
+    memory.slice(first_buffer_address, 3).fill(0);
+    memory.slice(second_buffer_address, 4).fill(0);
+    EXPECT_EQ(call(configuration, implementation, "fd_pread"sv, 5), 0u);
+    EXPECT_EQ(read_u32(memory, result_address), 6u);
+    EXPECT_EQ(StringView(memory.slice(first_buffer_address, 3)), "bcd"sv);
+    EXPECT_EQ(StringView(memory.slice(second_buffer_address, 4)), "efg\0"sv);
+    EXPECT_EQ(lseek(fd, 0, SEEK_CUR), 2);
+
+    close(fd);
+    unlink(filename);
+}
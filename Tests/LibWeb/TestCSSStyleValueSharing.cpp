@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+#include <LibWeb/CSS/StyleValues/ColorStyleValue.h>
+#include <LibWeb/CSS/StyleValues/IntegerStyleValue.h>
+#include <LibWeb/CSS/StyleValues/KeywordStyleValue.h>
+#include <LibWeb/CSS/StyleValues/LengthStyleValue.h>
+#include <LibWeb/CSS/StyleValues/NumberStyleValue.h>
+#include <LibWeb/CSS/StyleValues/PercentageStyleValue.h>
+
+namespace Web {
+
+TEST_CASE(keywords_are_shared)
+{
+    EXPECT_EQ(CSS::KeywordStyleValue::create(CSS::Keyword::Auto).ptr(), CSS::KeywordStyleValue::create(CSS::Keyword::Auto).ptr());
+    EXPECT_EQ(CSS::KeywordStyleValue::create(CSS::last_keyword).ptr(), CSS::KeywordStyleValue::create(CSS::last_keyword).ptr());
+    EXPECT_NE(CSS::KeywordStyleValue::create(CSS::Keyword::Auto).ptr(), CSS::KeywordStyleValue::create(CSS::Keyword::None).ptr());
+}
+
+TEST_CASE(small_lengths_are_shared)
+{
+    auto px = [](double value) { return CSS::LengthStyleValue::create(CSS::Length::make_px(value)); };
+
+    EXPECT_EQ(px(0).ptr(), px(0).ptr());
+    EXPECT_EQ(px(16).ptr(), px(16).ptr());
+    EXPECT_EQ(px(128).ptr(), px(128).ptr());
+
+    EXPECT_NE(px(129).ptr(), px(129).ptr());
+    EXPECT_NE(px(0.5).ptr(), px(0.5).ptr());
+    EXPECT_NE(px(-1).ptr(), px(-1).ptr());
+
+    // -0px serializes differently from 0px, so it mustn't be folded into it.
+    EXPECT_NE(px(-0.0).ptr(), px(0).ptr());
+    EXPECT(signbit(px(-0.0)->raw_value()));
+}
+
+TEST_CASE(small_percentages_are_shared)
+{
+    auto percentage = [](double value) { return CSS::PercentageStyleValue::create(CSS::Percentage(value)); };
+
+    EXPECT_EQ(percentage(0).ptr(), percentage(0).ptr());
+    EXPECT_EQ(percentage(50).ptr(), percentage(50).ptr());
+    EXPECT_EQ(percentage(100).ptr(), percentage(100).ptr());
+
+    EXPECT_NE(percentage(101).ptr(), percentage(101).ptr());
+    EXPECT_NE(percentage(33.3).ptr(), percentage(33.3).ptr());
+    EXPECT_NE(percentage(-0.0).ptr(), percentage(0).ptr());
+}
+
+TEST_CASE(small_integers_are_shared)
+{
+    EXPECT_EQ(CSS::IntegerStyleValue::create(0).ptr(), CSS::IntegerStyleValue::create(0).ptr());
+    EXPECT_EQ(CSS::IntegerStyleValue::create(1000).ptr(), CSS::IntegerStyleValue::create(1000).ptr());
+
+    EXPECT_NE(CSS::IntegerStyleValue::create(1001).ptr(), CSS::IntegerStyleValue::create(1001).ptr());
+    EXPECT_NE(CSS::IntegerStyleValue::create(-1).ptr(), CSS::IntegerStyleValue::create(-1).ptr());
+}
+
+TEST_CASE(small_numbers_are_shared)
+{
+    EXPECT_EQ(CSS::NumberStyleValue::create(0).ptr(), CSS::NumberStyleValue::create(0).ptr());
+    EXPECT_EQ(CSS::NumberStyleValue::create(400).ptr(), CSS::NumberStyleValue::create(400).ptr());
+    EXPECT_EQ(CSS::NumberStyleValue::create(1000).ptr(), CSS::NumberStyleValue::create(1000).ptr());
+
+    EXPECT_NE(CSS::NumberStyleValue::create(1001).ptr(), CSS::NumberStyleValue::create(1001).ptr());
+    EXPECT_NE(CSS::NumberStyleValue::create(0.5).ptr(), CSS::NumberStyleValue::create(0.5).ptr());
+
+    auto negative_zero = CSS::NumberStyleValue::create(-0.0);
+    EXPECT_NE(negative_zero.ptr(), CSS::NumberStyleValue::create(0).ptr());
+    EXPECT(signbit(negative_zero->number()));
+}
+
+TEST_CASE(colors_are_shared)
+{
+    auto color = [](Color value, CSS::ColorSyntax syntax = CSS::ColorSyntax::Legacy) { return CSS::ColorStyleValue::create_from_color(value, syntax); };
+
+    EXPECT_EQ(color(Color(1, 2, 3)).ptr(), color(Color(1, 2, 3)).ptr());
+    EXPECT_EQ(color(Color(1, 2, 3, 128)).ptr(), color(Color(1, 2, 3, 128)).ptr());
+
+    EXPECT_NE(color(Color(1, 2, 3)).ptr(), color(Color(1, 2, 4)).ptr());
+    EXPECT_NE(color(Color(1, 2, 3)).ptr(), color(Color(1, 2, 3), CSS::ColorSyntax::Modern).ptr());
+
+    // Named colors serialize as their name, so they aren't shared with the unnamed color of the same value.
+    EXPECT_NE(CSS::ColorStyleValue::create_from_color(Color::Red, CSS::ColorSyntax::Legacy, "red"_fly_string).ptr(), color(Color::Red).ptr());
+}
+
+}
@@ -396,6 +396,14 @@ BrowserWindow::BrowserWindow(Vector<URL::URL> const& initial_urls, IsPopupWindow
         debug_request("dump-layout-tree");
     });
 
+    auto* record_layout_trace_action = new QAction("Record Layout Trace", this);
+    record_layout_trace_action->setCheckable(true);
+    record_layout_trace_action->setIcon(load_icon_from_uri("resource://icons/16x16/layout.png"sv));
+    debug_menu->addAction(record_layout_trace_action);
+    QObject::connect(record_layout_trace_action, &QAction::triggered, this, [this, record_layout_trace_action] {
+        debug_request("layout-trace", record_layout_trace_action->isChecked() ? "on" : "off");
+    });
+
     auto* dump_paint_tree_action = new QAction("Dump &Paint Tree", this);
     dump_paint_tree_action->setIcon(load_icon_from_uri("resource://icons/16x16/layout.png"sv));
     debug_menu->addAction(dump_paint_tree_action);
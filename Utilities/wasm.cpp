@@ -17,6 +17,7 @@
 #include <LibMain/Main.h>
 #include <LibWasm/AbstractMachine/AbstractMachine.h>
 #include <LibWasm/AbstractMachine/BytecodeInterpreter.h>
+#include <LibWasm/AbstractMachine/Profiler.h>
 #include <LibWasm/Printer/Printer.h>
 #include <LibWasm/Types.h>
 #include <LibWasm/Wasi.h>
@@ -283,6 +284,10 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     Vector<ByteString> modules_to_link_in;
     Vector<StringView> args_if_wasi;
     Vector<StringView> wasi_preopened_mappings;
+    StringView profile_stacks_path;
+    StringView profile_opcodes_path;
+    StringView profile_functions_path;
+    u64 profile_sample_interval = 1000;
 
     Core::ArgsParser parser;
     parser.add_positional_argument(filename, "File name to parse", "file");
@@ -292,6 +297,10 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     parser.add_option(exported_function_to_execute, "Attempt to execute the named exported function from the module (implies -i)", "execute", 'e', "name");
     parser.add_option(export_all_imports, "Export noop functions corresponding to imports", "export-noop");
     parser.add_option(wasi, "Enable WASI", "wasi", 'w');
+    parser.add_option(profile_stacks_path, "Profile the executed function and write its sampled call stacks (collapsed format) to this file", "profile-stacks", 0, "file");
+    parser.add_option(profile_opcodes_path, "Profile the executed function and write its per-opcode execution counts to this file", "profile-opcodes", 0, "file");
+    parser.add_option(profile_functions_path, "Profile the executed function and write the call and instruction counts of every called function to this file", "profile-functions", 0, "file");
+    parser.add_option(profile_sample_interval, "Number of executed instructions between two call stack samples (default=1000)", "profile-sample-interval", 0, "count");
     parser.add_option(Core::ArgsParser::Option {
         .argument_mode = Core::ArgsParser::OptionArgumentMode::Required,
         .help_string = "Directory mappings to expose via WASI",
@@ -354,8 +363,15 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
         printer.print(*parse_result);
     }
 
+    auto const should_profile = !profile_stacks_path.is_empty() || !profile_opcodes_path.is_empty() || !profile_functions_path.is_empty();
+    if (should_profile && profile_sample_interval == 0) {
+        warnln("The profile sample interval must be at least 1");
+        return 1;
+    }
+
     if (attempt_instantiate || print_compiled) {
         Wasm::AbstractMachine machine;
+        Wasm::Profiler profiler { profile_sample_interval };
         Optional<Wasm::Wasi::Implementation> wasi_impl;
 
         if (wasi) {
@@ -410,6 +426,8 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
                 return 1;
             }
             linked_instances.append(instantiation_result.release_value());
+            if (should_profile)
+                profiler.register_module(linked_modules.last(), *linked_instances.last());
         }
 
         Wasm::Linker linker { *parse_result };
@@ -427,6 +445,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
                     continue;
                 }
                 auto address = machine.store().allocate(function.release_value());
+                profiler.set_function_name(*address, ByteString::formatted("wasi::{}", entry.name));
                 wasi_exports.set(entry, *address);
             }
 
@@ -485,6 +504,8 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
             return 1;
         }
         auto module_instance = result.release_value();
+        if (should_profile)
+            profiler.register_module(*parse_result, *module_instance);
 
         if (print_compiled) {
             for (auto address : module_instance->functions()) {
@@ -620,7 +641,28 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
                 outln();
             }
 
+            if (should_profile) {
+                g_interpreter.set_profiler(&profiler);
+                profiler.enter_function(*run_address);
+            }
+
             auto result = machine.invoke(g_interpreter, run_address.value(), move(values));
+
+            if (should_profile) {
+                profiler.exit_function();
+                g_interpreter.set_profiler(nullptr);
+
+                auto write_profile = [&](StringView path, auto write) -> ErrorOr<void> {
+                    if (path.is_empty())
+                        return {};
+                    auto file = TRY(Core::File::open(path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+                    TRY((profiler.*write)(*file));
+                    return {};
+                };
+                TRY(write_profile(profile_stacks_path, &Wasm::Profiler::write_collapsed_stacks));
+                TRY(write_profile(profile_opcodes_path, &Wasm::Profiler::write_opcode_histogram));
+                TRY(write_profile(profile_functions_path, &Wasm::Profiler::write_function_calls));
+            }
             if (result.is_trap()) {
                 auto trap_reason = result.trap().format();
                 if (trap_reason.starts_with("exit:"sv))